@@ -0,0 +1,193 @@
+/**
+ * @file adxl_decode_bench.c
+ * @brief Cerceve cozucu verim olcumu (Linux/POSIX)
+ *
+ * Rastgele icerikli ardisik cercevelerden bir tampon uretir; her cekirdek once
+ * skaler sonuc ile bit bit karsilastirilir, sonra en az `--seconds` boyunca
+ * tekrar tekrar cozulur. Iki olcum raporlanir:
+ *   stream : baslik dogrulama dahil adxl_decode_stream() (cerceve basina <= 32 ornek)
+ *   kernel : tek parca veri uzerinde adxl_decode_samples() (cekirdegin ust siniri)
+ * GB/s giris byte'i (baslik dahil) uzerinden hesaplanir.
+ *
+ * Kullanim: adxl_decode_bench [--mib N] [--count N] [--seconds S]
+ */
+#define _POSIX_C_SOURCE 199309L
+#include "adxl_decoder.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static uint32_t rng_state = 0x12345678;
+
+static uint32_t rng_next(void)
+{
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return rng_state >> 8;
+}
+
+static double now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void put_le32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+/**
+ * @brief `frames` adet `count` ornekli cerceve uretir; range bayragi cerceveden
+ *        cerceveye degisir. Toplam boyutu dondurur.
+ */
+static size_t make_stream(uint8_t *buf, size_t frames, unsigned count)
+{
+    uint8_t *p = buf;
+
+    for (size_t f = 0; f < frames; f++) {
+        memset(p, 0, ADXL_FRAME_HEADER_SIZE);
+        p[ADXL_FRAME_OFF_MAGIC] = ADXL_FRAME_MAGIC;
+        p[ADXL_FRAME_OFF_VERSION] = ADXL_FRAME_VERSION;
+        p[ADXL_FRAME_OFF_FLAGS] = (uint8_t)(f & 0x07);
+        p[ADXL_FRAME_OFF_COUNT] = (uint8_t)count;
+        put_le32(p + ADXL_FRAME_OFF_SEQ, (uint32_t)f);
+        put_le32(p + ADXL_FRAME_OFF_TIMESTAMP, (uint32_t)(f * 10));
+        p[ADXL_FRAME_OFF_BW_RATE] = 0x0F;
+        p += ADXL_FRAME_HEADER_SIZE;
+
+        for (unsigned i = 0; i < count * 3; i++) {
+            int16_t v = (int16_t)((int32_t)(rng_next() & 0x1FFF) - 4096);   /* 13 bit, FULL_RES araligi */
+
+            *p++ = (uint8_t)v;
+            *p++ = (uint8_t)((uint16_t)v >> 8);
+        }
+    }
+    return (size_t)(p - buf);
+}
+
+struct soa_buf {
+    struct adxl_soa soa;
+    float *mem;
+};
+
+static int soa_alloc(struct soa_buf *b, size_t capacity)
+{
+    b->mem = malloc(capacity * 3 * sizeof(float));
+    if (!b->mem) {
+        return -1;
+    }
+    b->soa.x = b->mem;
+    b->soa.y = b->mem + capacity;
+    b->soa.z = b->mem + 2 * capacity;
+    b->soa.count = 0;
+    b->soa.capacity = capacity;
+    return 0;
+}
+
+static int soa_equal(const struct adxl_soa *a, const struct adxl_soa *b)
+{
+    size_t n = a->count * sizeof(float);
+
+    return a->count == b->count && !memcmp(a->x, b->x, n) && !memcmp(a->y, b->y, n) && !memcmp(a->z, b->z, n);
+}
+
+int main(int argc, char **argv)
+{
+    double mib = 16.0, seconds = 1.0;
+    unsigned count = ADXL_FRAME_MAX_SAMPLES;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "--mib")) {
+            mib = atof(argv[i + 1]);
+        } else if (!strcmp(argv[i], "--count")) {
+            count = (unsigned)atoi(argv[i + 1]);
+        } else if (!strcmp(argv[i], "--seconds")) {
+            seconds = atof(argv[i + 1]);
+        } else {
+            fprintf(stderr, "kullanim: %s [--mib N] [--count 1..%d] [--seconds S]\n", argv[0], ADXL_FRAME_MAX_SAMPLES);
+            return 2;
+        }
+    }
+    if (count == 0 || count > ADXL_FRAME_MAX_SAMPLES || mib <= 0.0) {
+        fprintf(stderr, "gecersiz arguman\n");
+        return 2;
+    }
+
+    size_t frame_size = ADXL_FRAME_HEADER_SIZE + count * ADXL_FRAME_SAMPLE_SIZE;
+    size_t frames = (size_t)(mib * 1024 * 1024) / frame_size;
+    size_t samples = frames * count;
+    uint8_t *stream = malloc(frames * frame_size);
+    uint8_t *payload = malloc(samples * ADXL_FRAME_SAMPLE_SIZE);
+    struct soa_buf ref, out;
+
+    if (frames == 0 || !stream || !payload || soa_alloc(&ref, samples) || soa_alloc(&out, samples)) {
+        fprintf(stderr, "bellek ayrilamadi\n");
+        return 1;
+    }
+
+    size_t stream_len = make_stream(stream, frames, count);
+    for (size_t f = 0; f < frames; f++) {
+        memcpy(payload + f * count * ADXL_FRAME_SAMPLE_SIZE, stream + f * frame_size + ADXL_FRAME_HEADER_SIZE,
+               count * ADXL_FRAME_SAMPLE_SIZE);
+    }
+
+    adxl_decoder_set_impl(ADXL_DECODER_SCALAR);
+    adxl_decode_stream(stream, stream_len, &ref.soa, NULL);
+
+    printf("%zu cerceve x %u ornek, %.1f MiB, otomatik secim: %s\n", frames, count,
+           stream_len / (1024.0 * 1024.0), (adxl_decoder_set_impl(ADXL_DECODER_AUTO), adxl_decoder_impl_name(adxl_decoder_get_impl())));
+    printf("%-8s %-7s %10s %14s %10s\n", "cekirdek", "olcum", "GB/s", "Mornek/s", "ns/cerceve");
+
+    int failed = 0;
+    for (int impl = ADXL_DECODER_SCALAR; impl <= ADXL_DECODER_AVX2; impl++) {
+        const char *name = adxl_decoder_impl_name((enum adxl_decoder_impl)impl);
+
+        if (adxl_decoder_set_impl((enum adxl_decoder_impl)impl)) {
+            printf("%-8s desteklenmiyor\n", name);
+            continue;
+        }
+
+        struct adxl_stream_stats stats = { 0 };
+        out.soa.count = 0;
+        size_t used = adxl_decode_stream(stream, stream_len, &out.soa, &stats);
+        if (used != stream_len || stats.frames != frames || stats.seq_gaps || !soa_equal(&ref.soa, &out.soa)) {
+            printf("%-8s HATA: skaler sonuctan farkli\n", name);
+            failed = 1;
+            continue;
+        }
+
+        for (int mode = 0; mode < 2; mode++) {
+            unsigned passes = 0;
+            double start = now_s(), elapsed;
+
+            do {
+                if (mode == 0) {
+                    out.soa.count = 0;
+                    adxl_decode_stream(stream, stream_len, &out.soa, NULL);
+                } else {
+                    adxl_decode_samples(payload, samples, 3.906f, out.soa.x, out.soa.y, out.soa.z);
+                }
+                passes++;
+                elapsed = now_s() - start;
+            } while (elapsed < seconds);
+
+            double bytes = (double)(mode == 0 ? stream_len : samples * ADXL_FRAME_SAMPLE_SIZE) * passes;
+            double rate = (double)samples * passes / elapsed;
+
+            printf("%-8s %-7s %10.2f %14.1f %10.1f\n", name, mode == 0 ? "stream" : "kernel",
+                   bytes / elapsed / 1e9, rate / 1e6, elapsed * 1e9 / ((double)frames * passes));
+        }
+    }
+
+    free(stream);
+    free(payload);
+    free(ref.mem);
+    free(out.mem);
+    return failed;
+}
@@ -0,0 +1,91 @@
+/**
+ * @file adxl_decoder.h
+ * @brief ADXL345 FIFO cercevelerini (adxl_frame_format.h) cozen sunucu kutuphanesi
+ *
+ * Cihazdan gelen ardisik cerceveler, eksen basina ayri dizilere (structure of
+ * arrays) mg cinsinden float olarak cozulur. Ornek cozumu calisma aninda secilen
+ * bir cekirdek ile yapilir: AVX2, SSE4.1 (SSSE3 pshufb ile) veya skaler. Tum
+ * cekirdekler bit bit ayni sonucu uretir.
+ *
+ * Kutuphane C99'dur; C++'tan dogrudan kullanilabilir. Fonksiyonlar durum
+ * tutmaz (cekirdek secimi haric) ve farkli tamponlarla es zamanli cagrilabilir.
+ * Varsayilan cekirdek ilk cozumde bir kez secilir; adxl_decoder_set_impl()
+ * ise cozum yapan thread'ler baslamadan cagrilmalidir.
+ */
+#ifndef ADXL_DECODER_H
+#define ADXL_DECODER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include "adxl_frame_format.h"
+
+/** @brief Hata kodlari (negatif donus degerleri) */
+#define ADXL_DECODE_ERR_SHORT       (-1)    /*!< Tampon cerceveyi tamamen icermiyor   */
+#define ADXL_DECODE_ERR_MAGIC       (-2)    /*!< Baslik magic degeri hatali           */
+#define ADXL_DECODE_ERR_VERSION     (-3)    /*!< Desteklenmeyen format surumu         */
+#define ADXL_DECODE_ERR_COUNT       (-4)    /*!< Ornek sayisi 0 veya siniri asiyor    */
+#define ADXL_DECODE_ERR_SPACE       (-5)    /*!< Cikis dizilerinde yer yok            */
+
+/** @brief Ornek cozum cekirdekleri */
+enum adxl_decoder_impl {
+    ADXL_DECODER_AUTO = 0,      /*!< Olculen en hizli desteklenen cekirdek      */
+    ADXL_DECODER_SCALAR,
+    ADXL_DECODER_SSE41,
+    ADXL_DECODER_AVX2,
+};
+
+/** @brief Cozulmus baslik */
+struct adxl_frame_info {
+    uint8_t flags;              /*!< ADXL_FRAME_FLAG_* bitleri                  */
+    uint8_t count;              /*!< Ornek sayisi                               */
+    uint8_t bw_rate;            /*!< BW_RATE register degeri                    */
+    uint32_t seq;               /*!< Blok sira numarasi                         */
+    uint32_t timestamp_ms;      /*!< Cihaz zamani (ms)                          */
+    float scale_mg;             /*!< LSB basina mg                              */
+    size_t size;                /*!< Baslik dahil cerceve boyutu (byte)         */
+};
+
+/**
+ * @brief Cikis dizileri. Cozucu `count`'tan itibaren ekler, `capacity`'yi asmaz.
+ */
+struct adxl_soa {
+    float *x;
+    float *y;
+    float *z;
+    size_t count;
+    size_t capacity;
+};
+
+/** @brief Akis cozumu sayaclari; adxl_decode_stream() cagrilari arasinda birikir */
+struct adxl_stream_stats {
+    uint64_t frames;            /*!< Cozulen cerceve                            */
+    uint64_t samples;           /*!< Cozulen ornek                              */
+    uint64_t bad_frames;        /*!< Gecersiz baslik nedeniyle atlanan konum    */
+    uint64_t skipped_bytes;     /*!< Yeniden senkronizasyonda atlanan byte      */
+    uint64_t seq_gaps;          /*!< Sira numarasinda atlama (kayip cerceve)    */
+    uint64_t overruns;          /*!< Overrun bayragi tasiyan cerceve            */
+    uint32_t last_seq;
+    int have_seq;
+};
+
+int adxl_frame_parse(const uint8_t *buf, size_t len, struct adxl_frame_info *info);
+long adxl_decode_frame(const uint8_t *buf, size_t len, struct adxl_soa *out, struct adxl_frame_info *info);
+size_t adxl_decode_stream(const uint8_t *buf, size_t len, struct adxl_soa *out, struct adxl_stream_stats *stats);
+
+void adxl_decode_samples(const uint8_t *payload, size_t count, float scale_mg, float *x, float *y, float *z);
+float adxl_frame_scale_mg(uint8_t flags);
+
+int adxl_decoder_set_impl(enum adxl_decoder_impl impl);
+enum adxl_decoder_impl adxl_decoder_get_impl(void);
+int adxl_decoder_impl_supported(enum adxl_decoder_impl impl);
+const char *adxl_decoder_impl_name(enum adxl_decoder_impl impl);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ADXL_DECODER_H
@@ -0,0 +1,88 @@
+#include "decode_kernels.h"
+#include <immintrin.h>
+
+/**
+ * @brief Iki 16 byte'lik yuklemeyi 256 bit'in alt ve ust yarisina koyar.
+ */
+static inline __m256i load_pair(const uint8_t *lo, const uint8_t *hi)
+{
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)lo)),
+                                   _mm_loadu_si128((const __m128i *)hi), 1);
+}
+
+/**
+ * @brief 8 x int32'yi olcekleyip yazar.
+ */
+static inline void store_scaled(__m128i v, __m256 scale, float *out)
+{
+    _mm256_storeu_ps(out, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(v)), scale));
+}
+
+/**
+ * @brief pshufb maskesini 256 bit'in iki yarisina yayar.
+ *
+ * Maskeler yerel bir __m256i dizisinde tutulmaz: dizi 32 byte hizali bir
+ * yigin cercevesine yaziliyordu ve kisa (<= 32 ornek) cercevelerde bu giris
+ * maliyeti cozumun kendisi kadar suruyordu. Sabit tablodan dogrudan okununca
+ * derleyici maskeleri register'da tutar.
+ */
+static inline __m256i mask256(int k, int j)
+{
+    return _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)adxl_shuffle_masks[k][j]));
+}
+
+/**
+ * @brief 8 ornegi (48 byte) 128 bit'lik yollarla cozer; kalan icin.
+ */
+static inline void decode8(const uint8_t *p, __m256 scale, float *const out[3], size_t i)
+{
+    __m128i a = _mm_loadu_si128((const __m128i *)p);
+    __m128i b = _mm_loadu_si128((const __m128i *)(p + 16));
+    __m128i c = _mm_loadu_si128((const __m128i *)(p + 32));
+
+    for (int k = 0; k < 3; k++) {
+        __m128i v = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, _mm_loadu_si128((const __m128i *)adxl_shuffle_masks[k][0])),
+                                              _mm_shuffle_epi8(b, _mm_loadu_si128((const __m128i *)adxl_shuffle_masks[k][1]))),
+                                 _mm_shuffle_epi8(c, _mm_loadu_si128((const __m128i *)adxl_shuffle_masks[k][2])));
+
+        store_scaled(v, scale, out[k] + i);
+    }
+}
+
+/**
+ * @brief 16 ornek (96 byte) basina bir tur, kalan 8'li tur ve skaler uc.
+ *
+ * vpshufb 128 bit'lik yarilar icinde calistigi icin ornek 0..7 alt yariya,
+ * 8..15 ust yariya yuklenir; boylece SSE ile ayni maskeler her iki yarida
+ * kullanilir ve eksen sirasi korunur. Kalan 8'li grup ayni fonksiyonda VEX
+ * kodlu 128 bit'lik komutlarla cozulur; yalnizca son 0..7 ornek skalerdir.
+ */
+void adxl_decode_avx2(const uint8_t *payload, size_t count, float scale_mg, float *x, float *y, float *z)
+{
+    const __m256 scale = _mm256_set1_ps(scale_mg);
+    float *const out[3] = { x, y, z };
+    size_t i = 0;
+
+    for (; i + 16 <= count; i += 16) {
+        const uint8_t *p = payload + i * 6;
+        __m256i a = load_pair(p, p + 48);
+        __m256i b = load_pair(p + 16, p + 64);
+        __m256i c = load_pair(p + 32, p + 80);
+
+        for (int k = 0; k < 3; k++) {
+            __m256i v = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(a, mask256(k, 0)),
+                                                        _mm256_shuffle_epi8(b, mask256(k, 1))),
+                                        _mm256_shuffle_epi8(c, mask256(k, 2)));
+
+            store_scaled(_mm256_castsi256_si128(v), scale, out[k] + i);
+            store_scaled(_mm256_extracti128_si256(v, 1), scale, out[k] + i + 8);
+        }
+    }
+
+    if (i + 8 <= count) {
+        decode8(payload + i * 6, scale, out, i);
+        i += 8;
+    }
+
+    adxl_decode_scalar(payload + i * 6, count - i, scale_mg, x + i, y + i, z + i);
+}
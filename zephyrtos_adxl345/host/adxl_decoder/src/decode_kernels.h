@@ -0,0 +1,53 @@
+/**
+ * @file decode_kernels.h
+ * @brief Ornek cozum cekirdekleri (kutuphane ici)
+ *
+ * Her cekirdek `count` adet 6 byte'lik little-endian X/Y/Z uclusunu okur ve
+ * eksen dizilerine `(float)raw * scale_mg` yazar. Carpma her cekirdekte tek
+ * hassasiyetli tek islemdir; sonuclar bit bit aynidir.
+ */
+#ifndef DECODE_KERNELS_H
+#define DECODE_KERNELS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef void (*adxl_decode_kernel_t)(const uint8_t *payload, size_t count, float scale_mg,
+                                     float *x, float *y, float *z);
+
+void adxl_decode_scalar(const uint8_t *payload, size_t count, float scale_mg, float *x, float *y, float *z);
+
+#if defined(ADXL_DECODER_HAVE_SSE41)
+void adxl_decode_sse41(const uint8_t *payload, size_t count, float scale_mg, float *x, float *y, float *z);
+#endif
+#if defined(ADXL_DECODER_HAVE_AVX2)
+void adxl_decode_avx2(const uint8_t *payload, size_t count, float scale_mg, float *x, float *y, float *z);
+#endif
+
+/**
+ * @brief 8 ornekli (48 byte = 3 x 16 byte) grubu eksenlere ayiran pshufb maskeleri.
+ *
+ * Grup a, b, c yuklemelerine bolunur; X'ler a'da 0,3,6, b'de 1,4,7, c'de 2,5
+ * numarali 16 bit'lik kelimelerdedir (Y ve Z bir kayarak). Her eksen uc
+ * maskenin OR'u ile 8 kelimeye toplanir. -1 byte'lar sifir yazar.
+ * Sira: [eksen][a, b, c].
+ */
+static const int8_t adxl_shuffle_masks[3][3][16] = {
+    {   /* X */
+        {  0,  1,  6,  7, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+        { -1, -1, -1, -1, -1, -1,  2,  3,  8,  9, 14, 15, -1, -1, -1, -1 },
+        { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  4,  5, 10, 11 },
+    },
+    {   /* Y */
+        {  2,  3,  8,  9, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+        { -1, -1, -1, -1, -1, -1,  4,  5, 10, 11, -1, -1, -1, -1, -1, -1 },
+        { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  0,  1,  6,  7, 12, 13 },
+    },
+    {   /* Z */
+        {  4,  5, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
+        { -1, -1, -1, -1,  0,  1,  6,  7, 12, 13, -1, -1, -1, -1, -1, -1 },
+        { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  2,  3,  8,  9, 14, 15 },
+    },
+};
+
+#endif // DECODE_KERNELS_H
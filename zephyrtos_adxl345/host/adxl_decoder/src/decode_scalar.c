@@ -0,0 +1,15 @@
+#include "decode_kernels.h"
+
+/**
+ * @brief Tasinabilir cekirdek; islemcinin byte sirasindan bagimsizdir.
+ */
+void adxl_decode_scalar(const uint8_t *payload, size_t count, float scale_mg, float *x, float *y, float *z)
+{
+    for (size_t i = 0; i < count; i++) {
+        const uint8_t *p = payload + i * 6;
+
+        x[i] = (float)(int16_t)(p[0] | (p[1] << 8)) * scale_mg;
+        y[i] = (float)(int16_t)(p[2] | (p[3] << 8)) * scale_mg;
+        z[i] = (float)(int16_t)(p[4] | (p[5] << 8)) * scale_mg;
+    }
+}
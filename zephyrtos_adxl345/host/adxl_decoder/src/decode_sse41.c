@@ -0,0 +1,56 @@
+#include "decode_kernels.h"
+#include <immintrin.h>
+
+/**
+ * @brief 8 ornegi (48 byte) uc eksene ayirir; her eksen 8 x int16.
+ */
+static inline void deinterleave8(const uint8_t *p, __m128i axis[3])
+{
+    __m128i a = _mm_loadu_si128((const __m128i *)p);
+    __m128i b = _mm_loadu_si128((const __m128i *)(p + 16));
+    __m128i c = _mm_loadu_si128((const __m128i *)(p + 32));
+
+    for (int k = 0; k < 3; k++) {
+        __m128i ma = _mm_loadu_si128((const __m128i *)adxl_shuffle_masks[k][0]);
+        __m128i mb = _mm_loadu_si128((const __m128i *)adxl_shuffle_masks[k][1]);
+        __m128i mc = _mm_loadu_si128((const __m128i *)adxl_shuffle_masks[k][2]);
+
+        axis[k] = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, ma), _mm_shuffle_epi8(b, mb)),
+                               _mm_shuffle_epi8(c, mc));
+    }
+}
+
+/**
+ * @brief 8 x int16'yi isaret genisletip olcekler ve iki 4'lu float olarak yazar.
+ */
+static inline void store_scaled8(__m128i v, __m128 scale, float *out)
+{
+    __m128 lo = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(v));
+    __m128 hi = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(v, 8)));
+
+    _mm_storeu_ps(out, _mm_mul_ps(lo, scale));
+    _mm_storeu_ps(out + 4, _mm_mul_ps(hi, scale));
+}
+
+/**
+ * @brief SSSE3 pshufb ile eksen ayirma, SSE4.1 pmovsxwd ile isaret genisletme.
+ *
+ * Dongu 8 ornekte bir tam 48 byte okur; kalan ornekler skaler cekirdekle cozulur.
+ * Little-endian islemci varsayilir (x86).
+ */
+void adxl_decode_sse41(const uint8_t *payload, size_t count, float scale_mg, float *x, float *y, float *z)
+{
+    const __m128 scale = _mm_set1_ps(scale_mg);
+    size_t i = 0;
+
+    for (; i + 8 <= count; i += 8) {
+        __m128i axis[3];
+
+        deinterleave8(payload + i * 6, axis);
+        store_scaled8(axis[0], scale, x + i);
+        store_scaled8(axis[1], scale, y + i);
+        store_scaled8(axis[2], scale, z + i);
+    }
+
+    adxl_decode_scalar(payload + i * 6, count - i, scale_mg, x + i, y + i, z + i);
+}
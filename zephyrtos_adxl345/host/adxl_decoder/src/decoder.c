@@ -0,0 +1,315 @@
+#include "adxl_decoder.h"
+#include "decode_kernels.h"
+
+#if defined(_MSC_VER) && (defined(ADXL_DECODER_HAVE_SSE41) || defined(ADXL_DECODER_HAVE_AVX2))
+#include <intrin.h>
+#endif
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+static enum adxl_decoder_impl active_impl;
+static adxl_decode_kernel_t active_kernel;
+
+
+static uint32_t get_le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+#if defined(_MSC_VER) && (defined(ADXL_DECODER_HAVE_SSE41) || defined(ADXL_DECODER_HAVE_AVX2))
+/**
+ * @brief MSVC icin cpuid tabanli algilama; AVX2 icin isletim sisteminin YMM
+ *        register'larini kaydettigi de (XCR0) kontrol edilir.
+ */
+static int cpu_has(enum adxl_decoder_impl impl)
+{
+    int regs[4];
+
+    __cpuid(regs, 1);
+    int sse41 = (regs[2] >> 19) & 1;
+    int osxsave_avx = ((regs[2] >> 27) & 1) && ((regs[2] >> 28) & 1);
+
+    if (impl == ADXL_DECODER_SSE41) {
+        return sse41;
+    }
+    if (!sse41 || !osxsave_avx || (_xgetbv(0) & 0x6) != 0x6) {
+        return 0;
+    }
+    __cpuidex(regs, 7, 0);
+    return (regs[1] >> 5) & 1;
+}
+#elif defined(ADXL_DECODER_HAVE_SSE41) || defined(ADXL_DECODER_HAVE_AVX2)
+static int cpu_has(enum adxl_decoder_impl impl)
+{
+    __builtin_cpu_init();
+    if (impl == ADXL_DECODER_SSE41) {
+        return __builtin_cpu_supports("sse4.1") && __builtin_cpu_supports("ssse3");
+    }
+    return __builtin_cpu_supports("avx2");
+}
+#endif
+
+/**
+ * @brief Cekirdegin bu derlemede ve bu islemcide kullanilabilir olup olmadigi.
+ */
+int adxl_decoder_impl_supported(enum adxl_decoder_impl impl)
+{
+    switch (impl) {
+    case ADXL_DECODER_AUTO:
+    case ADXL_DECODER_SCALAR:
+        return 1;
+#if defined(ADXL_DECODER_HAVE_SSE41)
+    case ADXL_DECODER_SSE41:
+        return cpu_has(ADXL_DECODER_SSE41);
+#endif
+#if defined(ADXL_DECODER_HAVE_AVX2)
+    case ADXL_DECODER_AVX2:
+        return cpu_has(ADXL_DECODER_AVX2);
+#endif
+    default:
+        return 0;
+    }
+}
+
+static adxl_decode_kernel_t kernel_for(enum adxl_decoder_impl impl)
+{
+    switch (impl) {
+#if defined(ADXL_DECODER_HAVE_SSE41)
+    case ADXL_DECODER_SSE41:
+        return adxl_decode_sse41;
+#endif
+#if defined(ADXL_DECODER_HAVE_AVX2)
+    case ADXL_DECODER_AVX2:
+        return adxl_decode_avx2;
+#endif
+    default:
+        return adxl_decode_scalar;
+    }
+}
+
+/**
+ * @brief Ornek cozum cekirdegini secer.
+ *
+ * ADXL_DECODER_AUTO, olculen en hizli desteklenen cekirdegi secer: SSE4.1,
+ * yoksa skaler. Cerceveler en fazla 32 ornek oldugundan AVX2'nin 16'li turu
+ * cerceve basina en fazla iki kez calisir; adxl_decode_bench'te AVX2, 32
+ * ornekli cercevelerde SSE4.1 ile esit, 1..13 ornekte yavas olculdu. AVX2
+ * acikca secilebilir.
+ *
+ * Secim yapilmadan ilk cozum yapilirsa AUTO bir kez (pthread_once /
+ * InitOnceExecuteOnce) uygulanir; bu, es zamanli ilk cozumlerde de
+ * guvenlidir. Acik secim tum kutuphane icin ortaktir; cozum yapan thread'ler
+ * baslamadan yapilmalidir.
+ *
+ * @return Basariliysa 0, cekirdek desteklenmiyorsa -1 (secim degismez).
+ */
+int adxl_decoder_set_impl(enum adxl_decoder_impl impl)
+{
+    if (impl == ADXL_DECODER_AUTO) {
+        impl = adxl_decoder_impl_supported(ADXL_DECODER_SSE41) ? ADXL_DECODER_SSE41
+             : ADXL_DECODER_SCALAR;
+    }
+    if (!adxl_decoder_impl_supported(impl)) {
+        return -1;
+    }
+
+    active_impl = impl;
+    active_kernel = kernel_for(impl);
+    return 0;
+}
+
+/**
+ * @brief Acik secim yapilmadiysa AUTO'yu uygular; her cozumden once bir kez.
+ */
+#if defined(_WIN32)
+static INIT_ONCE default_once = INIT_ONCE_STATIC_INIT;
+
+static BOOL CALLBACK apply_default_impl(PINIT_ONCE once, PVOID param, PVOID *context)
+{
+    (void)once;
+    (void)param;
+    (void)context;
+    if (!active_kernel) {
+        adxl_decoder_set_impl(ADXL_DECODER_AUTO);
+    }
+    return TRUE;
+}
+
+static void ensure_kernel(void)
+{
+    InitOnceExecuteOnce(&default_once, apply_default_impl, NULL, NULL);
+}
+#else
+static pthread_once_t default_once = PTHREAD_ONCE_INIT;
+
+static void apply_default_impl(void)
+{
+    if (!active_kernel) {
+        adxl_decoder_set_impl(ADXL_DECODER_AUTO);
+    }
+}
+
+static void ensure_kernel(void)
+{
+    pthread_once(&default_once, apply_default_impl);
+}
+#endif
+
+enum adxl_decoder_impl adxl_decoder_get_impl(void)
+{
+    ensure_kernel();
+    return active_impl;
+}
+
+const char *adxl_decoder_impl_name(enum adxl_decoder_impl impl)
+{
+    switch (impl) {
+    case ADXL_DECODER_AUTO:     return "auto";
+    case ADXL_DECODER_SCALAR:   return "scalar";
+    case ADXL_DECODER_SSE41:    return "sse4.1";
+    case ADXL_DECODER_AVX2:     return "avx2";
+    default:                    return "?";
+    }
+}
+
+/**
+ * @brief Bayraklardaki range ve FULL_RES bitlerinden LSB agirligi (mg).
+ */
+float adxl_frame_scale_mg(uint8_t flags)
+{
+    unsigned shift = (flags & ADXL_FRAME_FLAG_FULL_RES) ? 0 : (flags & ADXL_FRAME_FLAG_RANGE_MASK);
+
+    return (float)(ADXL_FRAME_SCALE_UG << shift) / 1000.0f;
+}
+
+/**
+ * @brief `count` ornegi secili cekirdekle cozer.
+ *
+ * @param payload   Baslik sonrasi veri (count * 6 byte).
+ * @param scale_mg  LSB basina mg (adxl_frame_scale_mg()).
+ * @param x, y, z   En az `count` elemanlik cikis dizileri.
+ */
+void adxl_decode_samples(const uint8_t *payload, size_t count, float scale_mg, float *x, float *y, float *z)
+{
+    ensure_kernel();
+    active_kernel(payload, count, scale_mg, x, y, z);
+}
+
+/**
+ * @brief Cerceve basligini dogrular ve cozer; veriye dokunmaz.
+ *
+ * @return Basariliysa cerceve boyutu (byte), aksi halde ADXL_DECODE_ERR_*.
+ *         ADXL_DECODE_ERR_SHORT yalnizca baslik gecerliyse ve veri eksikse doner.
+ */
+int adxl_frame_parse(const uint8_t *buf, size_t len, struct adxl_frame_info *info)
+{
+    if (len < ADXL_FRAME_HEADER_SIZE) {
+        return (len > 0 && buf[ADXL_FRAME_OFF_MAGIC] != ADXL_FRAME_MAGIC) ? ADXL_DECODE_ERR_MAGIC
+                                                                          : ADXL_DECODE_ERR_SHORT;
+    }
+    if (buf[ADXL_FRAME_OFF_MAGIC] != ADXL_FRAME_MAGIC) {
+        return ADXL_DECODE_ERR_MAGIC;
+    }
+    if (buf[ADXL_FRAME_OFF_VERSION] != ADXL_FRAME_VERSION) {
+        return ADXL_DECODE_ERR_VERSION;
+    }
+
+    uint8_t count = buf[ADXL_FRAME_OFF_COUNT];
+    if (count == 0 || count > ADXL_FRAME_MAX_SAMPLES) {
+        return ADXL_DECODE_ERR_COUNT;
+    }
+
+    size_t size = ADXL_FRAME_HEADER_SIZE + (size_t)count * ADXL_FRAME_SAMPLE_SIZE;
+    if (len < size) {
+        return ADXL_DECODE_ERR_SHORT;
+    }
+
+    info->flags = buf[ADXL_FRAME_OFF_FLAGS];
+    info->count = count;
+    info->bw_rate = buf[ADXL_FRAME_OFF_BW_RATE];
+    info->seq = get_le32(buf + ADXL_FRAME_OFF_SEQ);
+    info->timestamp_ms = get_le32(buf + ADXL_FRAME_OFF_TIMESTAMP);
+    info->scale_mg = adxl_frame_scale_mg(info->flags);
+    info->size = size;
+    return (int)size;
+}
+
+/**
+ * @brief Tek bir cerceveyi cozer ve orneklerini `out` dizilerinin sonuna ekler.
+ *
+ * @return Basariliysa tuketilen byte sayisi, aksi halde ADXL_DECODE_ERR_*.
+ */
+long adxl_decode_frame(const uint8_t *buf, size_t len, struct adxl_soa *out, struct adxl_frame_info *info)
+{
+    int size = adxl_frame_parse(buf, len, info);
+
+    if (size < 0) {
+        return size;
+    }
+    if (out->capacity - out->count < info->count) {
+        return ADXL_DECODE_ERR_SPACE;
+    }
+
+    adxl_decode_samples(buf + ADXL_FRAME_HEADER_SIZE, info->count, info->scale_mg,
+                        out->x + out->count, out->y + out->count, out->z + out->count);
+    out->count += info->count;
+    return size;
+}
+
+/**
+ * @brief Ardisik cercevelerden olusan bir tamponu cozer.
+ *
+ * Gecersiz baslikta bir sonraki magic byte'ina kadar ilerlenir (yeniden
+ * senkronizasyon). Tamponun sonundaki yarim cerceve veya cikis dizilerinin
+ * dolmasi cozumu durdurur; donus degeri kadar byte tuketilmistir, kalan
+ * kisim bir sonraki cagriya yeni veri ile birlikte verilmelidir.
+ *
+ * @param stats Sayaclar; NULL olabilir.
+ * @return Tuketilen byte sayisi.
+ */
+size_t adxl_decode_stream(const uint8_t *buf, size_t len, struct adxl_soa *out, struct adxl_stream_stats *stats)
+{
+    struct adxl_stream_stats local = { 0 };
+    size_t pos = 0;
+
+    if (!stats) {
+        stats = &local;
+    }
+
+    while (pos < len) {
+        struct adxl_frame_info info;
+        long size = adxl_decode_frame(buf + pos, len - pos, out, &info);
+
+        if (size == ADXL_DECODE_ERR_SHORT || size == ADXL_DECODE_ERR_SPACE) {
+            break;
+        }
+        if (size < 0) {
+            size_t skip = 1;
+
+            while (pos + skip < len && buf[pos + skip] != ADXL_FRAME_MAGIC) {
+                skip++;
+            }
+            stats->bad_frames++;
+            stats->skipped_bytes += skip;
+            pos += skip;
+            continue;
+        }
+
+        if (stats->have_seq && info.seq != stats->last_seq + 1) {
+            stats->seq_gaps++;
+        }
+        if (info.flags & ADXL_FRAME_FLAG_OVERRUN) {
+            stats->overruns++;
+        }
+        stats->last_seq = info.seq;
+        stats->have_seq = 1;
+        stats->frames++;
+        stats->samples += info.count;
+        pos += (size_t)size;
+    }
+    return pos;
+}
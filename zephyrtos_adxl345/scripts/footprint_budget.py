@@ -0,0 +1,420 @@
+#!/usr/bin/env python3
+"""
+ADXL345 uygulamasi icin RAM/ROM butce raporu.
+
+Zephyr'in `ram_report` / `rom_report` hedeflerinin urettigi ram.json ve
+rom.json agaclarini `src/app_libs/<modul>` bazinda toplar, thread yiginlarini
+listeler ve footprint_budget.json'daki sinirlarla karsilastirir. Sinir
+asilirsa sifirdan farkli kodla cikar; boylece derleme hedefi basarisiz olur.
+
+Thread analyzer ciktisi (footprint.conf ile derlenen imajin konsol logu)
+verilirse thread basina gercek yigin kullanimi da raporlanir ve
+`stack_usage_max_pct` siniri uygulanir.
+
+Derleme GCC'nin -fstack-usage -fcallgraph-info=su secenekleriyle yapildiysa
+(.ci dosyalari) verilen thread giris fonksiyonlarinin en kotu durum yigin
+derinligi cagri grafigi uzerinden statik olarak hesaplanir. zbus listener'lari
+dolayli cagrildigi icin grafige kaynaktaki ZBUS_LISTENER_DEFINE /
+ZBUS_CHAN_ADD_OBS tanimlarindan eklenir: bir zbus_chan_pub() cagrisi, kanalin
+tum listener'larini zbus'in kendi cercevesinin ustunde cagirmis sayilir. Bu
+kontrol kartta calistirma gerektirmez ve `stack_usage_max_pct` ile uygulanir.
+
+Kart toplamlari ve kart basina modul sinirlari `--update` ile olculerek
+`boards.<kart>` altina yazilir ve yalnizca kayitli kartlarda uygulanir.
+Kayitli olmayan kartlarda ust duzey `modules` tahminleri uyari olarak
+raporlanir; tahmin edilmis bir sinir derlemeyi bozmaz.
+
+Kullanim:
+    footprint_budget.py --ram build/ram.json --rom build/rom.json \\
+                        --budget footprint_budget.json --board nrf52840dk_nrf52840
+    ... --save rapor.json             # raporu sakla
+    ... --compare eski_rapor.json     # onceki rapora gore farklar
+    ... --no-check                    # yalnizca raporla (taban cizgisi, karsilastirma)
+    ... --thread-log konsol.log       # thread analyzer ciktisi
+    ... --callgraph build --source src --entry event_loop_thread=1024
+                                      # statik en kotu durum yigin derinligi
+    ... --update                      # olculen degerlerle butceyi yenile
+"""
+
+import argparse
+import json
+import math
+import os
+import re
+import sys
+
+MODULE_RE = re.compile(r"app_libs/([^/]+)/")
+STACK_RE = re.compile(r"stack", re.IGNORECASE)
+THREAD_RE = re.compile(
+    r"(?P<name>[^\s:]+)\s*:\s+STACK: unused (?P<unused>\d+) usage (?P<usage>\d+) / "
+    r"(?P<size>\d+) \((?P<pct>\d+) %\)")
+
+CI_NODE_RE = re.compile(r'node: \{ title: "(?P<name>[^"]+)" label: "(?P<label>[^"]*)"')
+CI_EDGE_RE = re.compile(r'edge: \{ sourcename: "(?P<src>[^"]+)" targetname: "(?P<dst>[^"]+)"'
+                        r'(?: label: "(?P<site>[^"]*)")?')
+CI_FRAME_RE = re.compile(r"\\n(?P<bytes>\d+) bytes \((?P<kind>[^)]*)\)")
+LISTENER_RE = re.compile(r"ZBUS_LISTENER_DEFINE\(\s*(\w+)\s*,\s*(\w+)\s*\)")
+ADD_OBS_RE = re.compile(r"ZBUS_CHAN_ADD_OBS\(\s*(\w+)\s*,\s*(\w+)\s*,")
+CHAN_DEFINE_RE = re.compile(r"ZBUS_CHAN_DEFINE\(\s*(\w+)")
+PUB_RE = re.compile(r"zbus_chan_(?:pub|notify)\(\s*(&\s*(?P<chan>\w+))?")
+ZBUS_PUB_FUNCS = ("zbus_chan_pub", "zbus_chan_notify")
+
+# --update sirasinda olculen degerin uzerine eklenen pay
+UPDATE_HEADROOM = 0.10
+UPDATE_ALIGN = 64
+
+
+def load_leaves(path):
+    """size_report agacindaki yapraklari (tam yol, boyut) olarak dondurur."""
+    with open(path, encoding="utf-8") as f:
+        data = json.load(f)
+
+    root = data.get("symbols", data)
+    leaves = []
+
+    def walk(node, prefix):
+        name = node.get("name", "")
+        full = f"{prefix}/{name}" if prefix else name
+        children = node.get("children") or []
+        if not children:
+            leaves.append((full, int(node.get("size", 0))))
+            return
+        for child in children:
+            walk(child, full)
+
+    walk(root, "")
+    return int(root.get("size", sum(size for _, size in leaves))), leaves
+
+
+def module_sizes(leaves):
+    sizes = {}
+    for path, size in leaves:
+        match = MODULE_RE.search(path)
+        module = match.group(1) if match else "(zephyr/diger)"
+        sizes[module] = sizes.get(module, 0) + size
+    return sizes
+
+
+def stack_sizes(leaves):
+    stacks = {}
+    for path, size in leaves:
+        symbol = path.rsplit("/", 1)[-1]
+        if STACK_RE.search(symbol):
+            stacks[symbol] = stacks.get(symbol, 0) + size
+    return stacks
+
+
+def parse_thread_log(path):
+    """Thread analyzer satirlarindan her thread'in son olcumunu alir."""
+    threads = {}
+    with open(path, encoding="utf-8", errors="replace") as f:
+        for line in f:
+            match = THREAD_RE.search(line)
+            if match:
+                threads[match.group("name")] = {
+                    "usage": int(match.group("usage")),
+                    "size": int(match.group("size")),
+                    "pct": int(match.group("pct")),
+                }
+    return threads
+
+
+class CallGraph:
+    """-fcallgraph-info=su ciktilarindan olusan cagri grafigi.
+
+    Dugumler GCC'nin basliklariyla tutulur: static fonksiyonlar "dosya:isim",
+    digerleri yalnizca isimdir. Cercevesi bilinmeyen fonksiyonlar (assembly,
+    kutuphane) 0 bayt sayilir ve raporlanir. GCC ayni hedefe yapilan cagrilari
+    tek kenarda birlestirdigi icin bir zbus_chan_pub() kenari, cagiranin
+    dosyasinda yayinlanan tum kanallari temsil eder.
+    """
+
+    def __init__(self, ci_files, source_dir):
+        self.frames = {}        # baslik -> bayt
+        self.titles = {}        # isim -> [baslik, ...]
+        self.calls = {}         # baslik -> [(hedef, cagri yeri), ...]
+        self.notes = set()
+        self.source_dir = source_dir
+        for path in ci_files:
+            self._load(path)
+        self.listeners, self.file_chans = self._scan_zbus(source_dir)
+
+    def _load(self, path):
+        with open(path, encoding="utf-8", errors="replace") as f:
+            text = f.read()
+        for match in CI_NODE_RE.finditer(text):
+            frame = CI_FRAME_RE.search(match.group("label"))
+            if not frame:
+                continue
+            title = match.group("name")
+            name = match.group("label").split("\\n", 1)[0]
+            self.frames[title] = int(frame.group("bytes"))
+            self.titles.setdefault(name, []).append(title)
+            self.calls.setdefault(title, [])
+            if frame.group("kind") != "static":
+                self.notes.add(f"{name}: dinamik yigin ({frame.group('kind')})")
+        for match in CI_EDGE_RE.finditer(text):
+            self.calls.setdefault(match.group("src"), []).append(
+                (match.group("dst"), match.group("site")))
+
+    @staticmethod
+    def _scan_zbus(source_dir):
+        """Kanal -> listener geri cagirmalari ve dosya -> yayinlanan kanallar."""
+        texts = {}
+        for root, _, files in os.walk(source_dir):
+            for n in files:
+                if n.endswith((".c", ".h")):
+                    with open(os.path.join(root, n), encoding="utf-8", errors="replace") as f:
+                        texts[n] = f.read()
+
+        callbacks, listeners, file_chans = {}, {}, {}
+        for text in texts.values():
+            callbacks.update(dict(LISTENER_RE.findall(text)))
+        for name, text in texts.items():
+            for chan, listener in ADD_OBS_RE.findall(text):
+                if listener in callbacks:
+                    listeners.setdefault(chan, []).append(callbacks[listener])
+            chans = set()
+            for match in PUB_RE.finditer(text):
+                # Kanal bir degiskense dosyada tanimlanan tum kanallar
+                chans |= {match.group("chan")} if match.group("chan") else set(CHAN_DEFINE_RE.findall(text))
+            file_chans[name] = sorted(chans)
+        return listeners, file_chans
+
+    def _published_chans(self, site):
+        name = os.path.basename(site.rsplit(":", 2)[0])
+        if name not in self.file_chans:
+            self.notes.add(f"{site}: kaynak bulunamadi, yayinlanan kanal bilinmiyor")
+        return self.file_chans.get(name, [])
+
+    def depth(self, name):
+        """Fonksiyonun en kotu durum yigin derinligi ve o yolun fonksiyonlari."""
+        memo = {}
+
+        def walk(title, stack):
+            if title in memo:
+                return memo[title]
+            if title in stack:
+                self.notes.add(f"{title}: ozyineleme, dongu kesildi")
+                return 0, []
+            if title not in self.frames:
+                self.notes.add(f"{title}: cerceve bilgisi yok (0 bayt)")
+                return 0, [title]
+            stack = stack | {title}
+            best, best_path = 0, []
+            for target, site in self.calls.get(title, []):
+                if target.startswith("__indirect_call"):
+                    if not title.startswith("zbus_"):
+                        self.notes.add(f"{title}: cozulmemis dolayli cagri")
+                    continue
+                sub, sub_path = walk(target, stack)
+                if target in ZBUS_PUB_FUNCS and site:
+                    for chan in self._published_chans(site):
+                        for callback in self.listeners.get(chan, []):
+                            for cb_title in self.titles.get(callback, []):
+                                d, p = walk(cb_title, stack)
+                                if sub + d > best:
+                                    best, best_path = sub + d, sub_path + [f"[{chan}]"] + p
+                if sub > best:
+                    best, best_path = sub, sub_path
+            result = (self.frames[title] + best, [title.rsplit(":", 1)[-1]] + best_path)
+            memo[title] = result
+            return result
+
+        roots = [walk(t, frozenset()) for t in self.titles.get(name, [])]
+        return max(roots, key=lambda r: r[0]) if roots else None
+
+
+def stack_depths(args):
+    ci_files = []
+    for root, _, files in os.walk(args.callgraph):
+        ci_files += [os.path.join(root, n) for n in files if n.endswith(".ci")]
+    graph = CallGraph(ci_files, args.source)
+    depths = {}
+    for entry in args.entry:
+        name, size = entry.split("=")
+        result = graph.depth(name)
+        if result is None:
+            graph.notes.add(f"{name}: cagri grafiginde yok")
+            continue
+        depth, path = result
+        depths[name] = {"usage": depth, "size": int(size), "pct": depth * 100 // int(size),
+                        "path": path}
+    return depths, sorted(graph.notes)
+
+
+def build_report(args):
+    ram_total, ram_leaves = load_leaves(args.ram)
+    rom_total, rom_leaves = load_leaves(args.rom)
+    ram = module_sizes(ram_leaves)
+    rom = module_sizes(rom_leaves)
+
+    report = {
+        "board": args.board,
+        "total": {"ram": ram_total, "rom": rom_total},
+        "modules": {m: {"ram": ram.get(m, 0), "rom": rom.get(m, 0)}
+                    for m in sorted(set(ram) | set(rom))},
+        "stacks": stack_sizes(ram_leaves),
+    }
+    if args.thread_log:
+        report["threads"] = parse_thread_log(args.thread_log)
+    if args.callgraph:
+        report["static_stacks"], report["static_stack_notes"] = stack_depths(args)
+    return report
+
+
+def check_budget(report, budget):
+    """Sinir asimlarini (hata) ve tahmini sinir asimlarini (uyari) dondurur."""
+    violations = []
+    warnings = []
+
+    board = budget.get("boards", {}).get(report["board"])
+    sink = violations if board is not None else warnings
+
+    def over(what, kind, used, limit):
+        if limit is not None and used > limit:
+            sink.append(f"{what} {kind}: {used} > {limit} bayt (+{used - limit})")
+
+    if board is None:
+        warnings.append(f"kart {report['board']} kayitli degil; sinirlar tahmindir "
+                        "(footprint_budget_update ile kaydedin)")
+        board = {"modules": budget.get("modules", {})}
+    for kind in ("ram", "rom"):
+        over("toplam", kind, report["total"][kind], board.get(kind))
+
+    for module, limits in board.get("modules", {}).items():
+        used = report["modules"].get(module, {"ram": 0, "rom": 0})
+        for kind in ("ram", "rom"):
+            over(module, kind, used[kind], limits.get(kind))
+
+    max_pct = budget.get("stack_usage_max_pct")
+    for source, label in (("threads", "thread"), ("static_stacks", "statik")):
+        for name, thread in report.get(source, {}).items():
+            if max_pct is not None and thread["pct"] > max_pct:
+                violations.append(f"{label} {name} yigin kullanimi: %{thread['pct']} > %{max_pct} "
+                                  f"({thread['usage']} / {thread['size']})")
+    return violations, warnings
+
+
+def print_report(report, base=None):
+    def delta(now, before):
+        if before is None:
+            return ""
+        diff = now - before
+        return f" ({diff:+d})" if diff else ""
+
+    base_modules = base["modules"] if base else {}
+    print(f"Kart: {report['board']}")
+    print(f"{'modul':<20} {'RAM':>14} {'ROM':>14}")
+    for module, used in report["modules"].items():
+        prev = base_modules.get(module, {})
+        print(f"{module:<20} {used['ram']:>7}{delta(used['ram'], prev.get('ram')):>7} "
+              f"{used['rom']:>7}{delta(used['rom'], prev.get('rom')):>7}")
+    total = report["total"]
+    prev = base["total"] if base else {}
+    print(f"{'TOPLAM':<20} {total['ram']:>7}{delta(total['ram'], prev.get('ram')):>7} "
+          f"{total['rom']:>7}{delta(total['rom'], prev.get('rom')):>7}")
+
+    base_stacks = base.get("stacks", {}) if base else {}
+    print("\nStatik yiginlar:")
+    for symbol, size in sorted(report["stacks"].items(), key=lambda kv: -kv[1]):
+        print(f"  {symbol:<40} {size:>7}{delta(size, base_stacks.get(symbol)):>7}")
+    for symbol in sorted(set(base_stacks) - set(report["stacks"])):
+        print(f"  {symbol:<40} {'kaldirildi':>7} ({-base_stacks[symbol]:+d})")
+
+    if report.get("threads"):
+        base_threads = base.get("threads", {}) if base else {}
+        print("\nThread yigin kullanimi (thread analyzer):")
+        for name, thread in report["threads"].items():
+            prev = base_threads.get(name, {})
+            print(f"  {name:<40} {thread['usage']:>5}{delta(thread['usage'], prev.get('usage')):>7} "
+                  f"/ {thread['size']:<5}{delta(thread['size'], prev.get('size')):>7} %{thread['pct']}")
+
+    if report.get("static_stacks"):
+        base_static = base.get("static_stacks", {}) if base else {}
+        print("\nEn kotu durum yigin derinligi (cagri grafigi):")
+        for name, thread in report["static_stacks"].items():
+            prev = base_static.get(name, {})
+            print(f"  {name:<40} {thread['usage']:>5}{delta(thread['usage'], prev.get('usage')):>7} "
+                  f"/ {thread['size']:<5}{delta(thread['size'], prev.get('size')):>7} %{thread['pct']}")
+            print(f"    {' > '.join(thread['path'])}")
+        for note in report.get("static_stack_notes", []):
+            print(f"  not: {note}")
+
+
+def round_budget(value):
+    return int(math.ceil(value * (1 + UPDATE_HEADROOM) / UPDATE_ALIGN) * UPDATE_ALIGN)
+
+
+def update_budget(report, budget):
+    board = budget.setdefault("boards", {}).setdefault(report["board"], {})
+    for kind in ("ram", "rom"):
+        board[kind] = round_budget(report["total"][kind])
+
+    board["modules"] = {module: {kind: round_budget(used[kind]) for kind in ("ram", "rom")}
+                        for module, used in report["modules"].items() if not module.startswith("(")}
+    return budget
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--ram", required=True, help="ram_report ciktisi (ram.json)")
+    parser.add_argument("--rom", required=True, help="rom_report ciktisi (rom.json)")
+    parser.add_argument("--budget", required=True, help="butce dosyasi (footprint_budget.json)")
+    parser.add_argument("--board", required=True, help="kart adi (BOARD)")
+    parser.add_argument("--thread-log", help="thread analyzer iceren konsol logu")
+    parser.add_argument("--callgraph", help=".ci dosyalarinin aranacagi derleme dizini")
+    parser.add_argument("--source", default="src", help="zbus tanimlarinin aranacagi kaynak dizini")
+    parser.add_argument("--entry", action="append", default=[],
+                        help="thread giris fonksiyonu ve yigin boyutu: isim=bayt")
+    parser.add_argument("--save", help="raporu bu dosyaya yaz")
+    parser.add_argument("--compare", help="onceki rapor; farklar parantez icinde gosterilir")
+    parser.add_argument("--no-check", action="store_true",
+                        help="butceyi kontrol etme; yalnizca raporla ve kaydet")
+    parser.add_argument("--update", action="store_true",
+                        help="butceyi olculen degerler + %%10 pay ile yeniden yaz")
+    args = parser.parse_args()
+
+    report = build_report(args)
+
+    base = None
+    if args.compare:
+        with open(args.compare, encoding="utf-8") as f:
+            base = json.load(f)
+    print_report(report, base)
+
+    if args.save:
+        with open(args.save, "w", encoding="utf-8") as f:
+            json.dump(report, f, indent=2)
+
+    if args.no_check:
+        return 0
+
+    with open(args.budget, encoding="utf-8") as f:
+        budget = json.load(f)
+
+    if args.update:
+        with open(args.budget, "w", encoding="utf-8") as f:
+            json.dump(update_budget(report, budget), f, indent=2)
+            f.write("\n")
+        print(f"\nButce guncellendi: {args.budget}")
+        return 0
+
+    violations, warnings = check_budget(report, budget)
+    if warnings:
+        print("\nUyari (uygulanmadi):")
+        for warning in warnings:
+            print(f"  {warning}")
+    if violations:
+        print("\nBUTCE ASILDI:", file=sys.stderr)
+        for violation in violations:
+            print(f"  {violation}", file=sys.stderr)
+        return 1
+
+    print("\nButce: tamam")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
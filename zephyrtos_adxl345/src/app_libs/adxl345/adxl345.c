@@ -1,122 +1,248 @@
 #include"adxl345.h"
+#include"spi_bus.h"
+#include"gpio_settings.h"
+#include <string.h>
+#include <zephyr/sys/byteorder.h>
 
 LOG_MODULE_REGISTER(adxl345, LOG_LEVEL_DBG);
 
 
 
-struct spi_dt_spec spispec = SPI_DT_SPEC_GET(DT_NODELABEL(mysensor1), SPIOP,0);
+static const struct adxl345_bus adxl_bus = ADXL345_BUS_DT_SPEC;
+
+static K_MUTEX_DEFINE(adxl_config_lock);
+
+static struct adxl345_config adxl_config = {
+    .bw_rate        = ADXL345_DEFAULT_BW_RATE,
+    .data_format    = ADXL345_DEFAULT_DATA_FORMAT,
+    .thresh_act     = ADXL345_DEFAULT_THRESH_ACT,
+    .thresh_inact   = ADXL345_DEFAULT_THRESH_INACT,
+    .time_inact     = ADXL345_DEFAULT_TIME_INACT,
+};
+
+/*
+ * FIFO'daki orneklerin yakalandigi DATA_FORMAT. Yalnizca hat oturumu icinde
+ * yazilir ve okunur; DATA_FORMAT degisirken FIFO ayni oturumda bosaltilir.
+ */
+static uint8_t fifo_data_format = ADXL345_DEFAULT_DATA_FORMAT;
+
+static struct adxl345_stats adxl_stats;
+static struct k_spinlock adxl_stats_lock;
+
+/*
+ * Guc durumu izleme. Sensore yazilan BW_RATE/POWER_CTL ve okunan INT_SOURCE
+ * degerlerinden cikarilir; ek hat islemi yapilmaz. Baslangic degerleri
+ * sensorun reset degerleridir (standby, 100 Hz). adxl_stats_lock ile korunur.
+ */
+static uint64_t residency_ticks[ADXL345_PSTATE_COUNT];
+static uint32_t residency_transitions;
+static uint8_t residency_state = ADXL345_PSTATE_STANDBY;
+static int64_t residency_since;
+static uint8_t residency_bw_rate = ADXL_BW_RATE_100HZ;
+static uint8_t residency_power_ctl;
+static bool residency_asleep;
 
 
 /**
- * @brief  SPI cihazına güvenli bir şekilde erişim sağlayan yardımcı fonksiyon.
+ * @brief  Sensor hattina güvenli bir şekilde erişim sağlayan yardımcı fonksiyon.
  * 
- * Bu fonksiyon, `spispec` isimli SPI cihaz spesifikasyonuna güvenli erişim sağlar.
- * Fonksiyonun kullanılması, global değişkenlere doğrudan erişim yerine kontrollü 
- * bir erişim noktası sunar. Bu yöntem, `extern` kullanılarak değişkenlere doğrudan 
- * erişimin neden olabileceği karmaşıklıkları ve güvenlik açıklarını ortadan kaldırır.
+ * Bu fonksiyon, `adxl_bus` isimli hat tanımına (SPI veya I2C, devicetree'ye
+ * göre) güvenli erişim sağlar. Fonksiyonun kullanılması, global değişkenlere
+ * doğrudan erişim yerine kontrollü bir erişim noktası sunar.
  *
- * @note   Bu fonksiyon, başka modüllerden `spispec` değişkenine erişim sağlamak 
- *         için kullanılabilir. Ancak istem dışı erişimleri ve değiştirmeleri engellemek 
- *         için global erişim kısıtlanmıştır.
+ * @note   Dönen işaretçi spi_bus oturumlarında cihaz kimliği olarak da kullanılır.
  *
- * @return struct spi_dt_spec*  SPI cihaz spesifikasyonu (`spispec`) için bir pointer döndürür.
+ * @return const struct adxl345_bus*  Hat tanımı (`adxl_bus`) için bir pointer döndürür.
  */
-public struct spi_dt_spec* get_spi_device(void)
+public const struct adxl345_bus *adxl345_get_bus(void)
 {
-    return &spispec;
+    return &adxl_bus;
 }
 
 
 /**
- * @brief Verilen değer ile ADX_SPI değerini bit düzeyinde işler ve sonucunu döndürür.
+ * @brief Bir hat isleminin sonucunu performans sayaclarina ekler.
  *
- * Bu fonksiyon, verilen `value` değeri ile `ADX_SPI` değerini bit OR işlemi yaparak işler.
- * Bit düzeyinde yapılan işlem sonucu elde edilen değeri döndürür.
+ * Okuma/yazma fonksiyonlari tarafindan her islem sonunda cagrilir. Sayaclar
+ * interrupt ve thread baglamlarindan guncellenebildigi icin spinlock ile korunur.
  *
- * @param value İşlenecek olan değer.
- * @param ADX_SPI Bit düzeyinde işlemek için kullanılacak değer.
- * @return Bit düzeyinde işlenmiş sonuç.
+ * @param is_read   Islem okuma ise true, yazma ise false.
+ * @param bytes     Aktarilan veri byte sayisi (komut/adres byte'lari haric).
+ * @param start     Islem baslangicindaki cycle sayaci degeri.
+ * @param err       Islemin donus degeri.
  */
-private uint8_t byte_operation( uint8_t value , uint8_t ADX_SPI )
+private void update_stats( bool is_read , uint8_t bytes , uint32_t start , int err )
 {
-	return ( value | ADX_SPI) ;
+    uint32_t cycles = k_cycle_get_32() - start;
+    k_spinlock_key_t key = k_spin_lock(&adxl_stats_lock);
+
+    if (is_read) {
+        adxl_stats.read_count++;
+    } else {
+        adxl_stats.write_count++;
+    }
+
+    if (err < 0) {
+        adxl_stats.error_count++;
+    } else {
+        adxl_stats.bytes += bytes;
+        adxl_stats.wire_bits += adxl345_bus_wire_bits(ADXL345_BUS_TYPE, is_read, bytes);
+    }
+
+    adxl_stats.total_cycles += cycles;
+    if (cycles > adxl_stats.max_cycles) {
+        adxl_stats.max_cycles = cycles;
+    }
+
+    k_spin_unlock(&adxl_stats_lock, key);
 }
 
 /**
- * @brief SPI üzerinden belirtilen register'a veri yazma işlemi yapar.
+ * @brief Izlenen register degerlerinden sensorun guc durumunu hesaplar.
+ */
+private uint8_t residency_current_state( void )
+{
+    if (!(residency_power_ctl & ADXL_POWER_CTL_MEASURE)) {
+        return ADXL345_PSTATE_STANDBY;
+    }
+    if ((residency_power_ctl & ADXL_POWER_CTL_SLEEP) || residency_asleep) {
+        return ADXL345_PSTATE_SLEEP;
+    }
+    return residency_bw_rate & (ADXL_BW_RATE_LOW_POWER | ADXL_BW_RATE_3200HZ);
+}
+
+/**
+ * @brief Basarili bir register erisimini guc durumu izlemesine yansitir.
  *
- * Bu fonksiyon, belirtilen SPI ayarlarına göre verilen register'a belirtilen değeri yazar.
- * İlgili register adresi ve yazılacak değer `reg` ve `value` parametreleri olarak alınır.
- * Yazma işlemi için SPI ile iletişim sağlanır ve hata durumunda hata kodu döner.
+ * BW_RATE ve POWER_CTL yazmalari hizi ve modu, INT_SOURCE okumalari auto-sleep
+ * durumunu (aktivite: uyanik, inaktivite: uyku) belirler. Burst erisimlerde
+ * izlenen register'in aralikta olup olmadigina bakilir.
  *
- * @param spispec SPI ayarları yapısı işaretçisi.
- * @param reg Yazılacak register adresi.
- * @param value Yazılacak değer.
- * @return Yazma işlemi başarılıysa 0, aksi halde hata kodu.
+ * @param is_read   Islem okuma ise true.
+ * @param reg       Ilk register adresi.
+ * @param data      Okunan veya yazilan degerler.
+ * @param size      Byte sayisi.
  */
-private int write_reg( const struct spi_dt_spec *spispec , uint8_t reg , uint8_t value )
+private void note_residency( bool is_read , uint8_t reg , const uint8_t *data , uint8_t size )
 {
-    int err ;
-    uint8_t tx_buf[2];
+    k_spinlock_key_t key = k_spin_lock(&adxl_stats_lock);
+
+    if (is_read) {
+        if (reg <= ADXL345_INT_SOURCE && ADXL345_INT_SOURCE < reg + size) {
+            uint8_t source = data[ADXL345_INT_SOURCE - reg];
+
+            if (source & ADXL_INT_SOURCE_ACTIVITY) {
+                residency_asleep = false;
+            } else if ((source & ADXL_INT_SOURCE_INACTIVITY) &&
+                       (residency_power_ctl & ADXL_POWER_CTL_AUTO_SLEEP)) {
+                residency_asleep = true;
+            }
+        }
+    } else {
+        if (reg <= ADXL345_BW_RATE && ADXL345_BW_RATE < reg + size) {
+            residency_bw_rate = data[ADXL345_BW_RATE - reg];
+        }
+        if (reg <= ADXL345_POWER_CTL && ADXL345_POWER_CTL < reg + size) {
+            uint8_t power = data[ADXL345_POWER_CTL - reg];
+
+            /* Olcume gecis ve AUTO_SLEEP'in kapatilmasi sensoru uyandirir */
+            if (!(residency_power_ctl & ADXL_POWER_CTL_MEASURE) || !(power & ADXL_POWER_CTL_AUTO_SLEEP)) {
+                residency_asleep = false;
+            }
+            residency_power_ctl = power;
+        }
+    }
+
+    uint8_t state = residency_current_state();
+
+    if (state != residency_state) {
+        int64_t now = k_uptime_ticks();
+
+        residency_ticks[residency_state] += now - residency_since;
+        residency_since = now;
+        residency_state = state;
+        residency_transitions++;
+    }
 
-    tx_buf[0] = reg;
-    tx_buf[1] = value;
+    k_spin_unlock(&adxl_stats_lock, key);
+}
 
-    struct spi_buf 		tx_spi_buf 		= {.buf = tx_buf, .len = sizeof(tx_buf)};
-	struct spi_buf_set 	tx_spi_buf_set	= {.buffers = &tx_spi_buf, .count = 1};
+/**
+ * @brief Ardisik register'lara tek bir burst islemi ile yazar.
+ *
+ * Tasima (SPI veya I2C) derleme aninda secilir; bkz. adxl345_bus.h.
+ * Hat spi_bus zamanlayicisindan NORMAL sinifla alinir; cagiran thread hatti
+ * zaten tutuyorsa islem o oturum icinde yapilir.
+ *
+ * @param bus   Sensor hatti.
+ * @param reg   Yazilacak ilk register adresi.
+ * @param data  Yazilacak degerler.
+ * @param size  Yazilacak byte sayisi.
+ * @return Yazma işlemi başarılıysa 0, aksi halde hata kodu.
+ */
+public int adxl345_write_regs( const struct adxl345_bus *bus , uint8_t reg , const uint8_t *data , uint8_t size )
+{
+    int err;
+    uint32_t start = k_cycle_get_32();
 
-    err = spi_write_dt(spispec , &tx_spi_buf_set);
-    if(err < 0 )
-    {
-        LOG_ERROR("SPI yazma basarisiz (reg=0x%02X, value=0x%02X), err=%d", reg, value, err);
+    err = spi_bus_acquire(bus, SPI_BUS_CLASS_NORMAL, 0);
+    if (!err) {
+        start = k_cycle_get_32();
+        err = adxl345_bus_write(bus, reg, data, size);
+        spi_bus_release();
+    }
+    update_stats(false, size, start, err);
+    if (err < 0) {
+        LOG_ERROR("Yazma basarisiz (reg=0x%02X, %u byte), err=%d", reg, size, err);
         return err;
     }
-    LOG_DEBUG("SPI yazma basarili (reg=0x%02X, value=0x%02X)", reg, value);
-    return 0 ;    
+    note_residency(false, reg, data, size);
+    LOG_DEBUG("Yazma basarili (reg=0x%02X, %u byte)", reg, size);
+    return 0;
+}
+
+/**
+ * @brief Belirtilen register'a veri yazma işlemi yapar.
+ *
+ * @param bus Sensor hatti.
+ * @param reg Yazılacak register adresi.
+ * @param value Yazılacak değer.
+ * @return Yazma işlemi başarılıysa 0, aksi halde hata kodu.
+ */
+public int adxl345_write_reg( const struct adxl345_bus *bus , uint8_t reg , uint8_t value )
+{
+    return adxl345_write_regs(bus, reg, &value, 1);
 }
 
 /**
- * @brief SPI üzerinden belirtilen register'dan veri okur.
+ * @brief Belirtilen register'dan (birden fazla byte ise ardisik register'lardan) veri okur.
  *
- * Bu fonksiyon, belirtilen SPI ayarlarına göre verilen register'dan veri okuma işlemini gerçekleştirir.
- * Register adresine okuma işlemi için gereken SPI komutlarını ekler (örneğin, 0x80 okuma işareti).
- * Gerekirse, multi-byte (çoklu byte) okuma modunu destekler (0x40 multi-byte bitini ayarlar).
- * Okunan veriyi `data` dizisine yazar.
+ * Cok byte'li okuma tek bir burst islemidir: SPI'da multi-byte biti, I2C'de
+ * cihazin adres otomatik artirimi kullanilir. Hat erisimi adxl345_write_regs()
+ * ile aynidir.
  *
- * @param spispec SPI ayarları yapısı işaretçisi.
+ * @param bus Sensor hatti.
  * @param reg Okunacak register adresi.
  * @param data Okunan verinin yazılacağı buffer.
  * @param size Okunacak veri miktarı.
  * @return Okuma işlemi başarılıysa 0, aksi halde hata kodu.
  */
-public int spi_read_reg( const struct spi_dt_spec *spispec , uint8_t reg , uint8_t *data , uint8_t size ) {
+public int adxl345_read_reg( const struct adxl345_bus *bus , uint8_t reg , uint8_t *data , uint8_t size ) {
     int err;
-    uint8_t tx_buffer[1] = {0};
+    uint32_t start = k_cycle_get_32();
 
-    
-    tx_buffer[0] =   byte_operation(reg ,ADXL_SPI_READ );           /*!< Okuma işlemi için 0x80 ekle */
-    if (size > 1) {
-        tx_buffer[0] = byte_operation(tx_buffer[0] ,ADXL_SPI_MB );  /*!< Multibyte okuma için 0x40 ekle */
+    err = spi_bus_acquire(bus, SPI_BUS_CLASS_NORMAL, 0);
+    if (!err) {
+        start = k_cycle_get_32();
+        err = adxl345_bus_read(bus, reg, data, size);
+        spi_bus_release();
     }
-
-    struct spi_buf tx_spi_buf = {.buf = tx_buffer, .len = sizeof(tx_buffer)};
-    struct spi_buf_set tx_spi_buf_set = {.buffers = &tx_spi_buf, .count = 1};
-
-
-    struct spi_buf rx_spi_bufs[2];
-    rx_spi_bufs[0].buf = NULL;
-    rx_spi_bufs[0].len = sizeof(tx_buffer); 
-    rx_spi_bufs[1].buf = data;
-    rx_spi_bufs[1].len = size;
-
-    struct spi_buf_set rx_spi_buf_set = {.buffers = rx_spi_bufs, .count = 2};
-
-   
-    err = spi_transceive_dt(spispec, &tx_spi_buf_set, &rx_spi_buf_set);
+    update_stats(true, size, start, err);
     if (err < 0) {
-        LOG_ERROR("spi_transceive_dt() failed, err: %d", err);
+        LOG_ERROR("Okuma basarisiz (reg=0x%02X, %u byte), err=%d", reg, size, err);
         return err;
     }
+    note_residency(true, reg, data, size);
 
     return 0;
 }
@@ -129,6 +255,7 @@ public int spi_read_reg( const struct spi_dt_spec *spispec , uint8_t reg , uint8
  *
  * Bu fonksiyon, ADXL345 ivmeölçeri için kesme işlemlerini başlatır:
  * - Bant genişliği hızını düşük güç moduna ayarlar.
+ * - Veri formatını (FULL_RES ve range) yazar.
  * - Kesme konfigürasyonlarını yapmadan önce kesme etkinleştirmeyi devre dışı bırakır.
  * - Güç kontrol register'ında bağlantı ve otomatik uyku modlarını aktifleştirir.
  * - Aktivite algılama için eşik değerini belirler.
@@ -144,68 +271,69 @@ private int init_adxl_interrupt(void)
     
     int err; 
 
+    if (!adxl345_bus_is_ready(&adxl_bus)) {
+        LOG_ERROR("ADXL345 hatti hazir degil");
+        return -ENODEV;
+    }
+
     /*!< ADXL345_BW_RATE Register: Low power modu ayari */
-    err = write_reg(&spispec, ADXL345_BW_RATE,  ADXL_BW_RATE_0_10HZ);
+    err = adxl345_write_reg(&adxl_bus, ADXL345_BW_RATE,  adxl_config.bw_rate);
     if (err) {
         LOG_ERROR("ADXL345_BW_RATE yazma hatasi: %d", err);
         return err;
     }
 
+    /*!< ADXL345_DATA_FORMAT Register: FULL_RES ve range ayari */
+    err = adxl345_write_reg(&adxl_bus, ADXL345_DATA_FORMAT, adxl_config.data_format);
+    if (err) {
+        LOG_ERROR("ADXL345_DATA_FORMAT yazma hatasi: %d", err);
+        return err;
+    }
+
     /*!< ADXL345_INT_ENABLE Register: Interruptlari devre disi birakma */
-    err = write_reg(&spispec, ADXL345_INT_ENABLE, ADXL_INT_DISABLE_ALL);
+    err = adxl345_write_reg(&adxl_bus, ADXL345_INT_ENABLE, ADXL_INT_DISABLE_ALL);
     if (err) {
         LOG_ERROR("ADXL345_INT_ENABLE devre disi birakma hatasi: %d", err);
         return err;
     }
 
     /*!< ADXL345_POWER_CTL Register: Link-bit ve auto-sleep ayari */
-    err = write_reg(&spispec, ADXL345_POWER_CTL,    ADXL_POWER_CTL_LINK | 
+    err = adxl345_write_reg(&adxl_bus, ADXL345_POWER_CTL,    ADXL_POWER_CTL_LINK | 
                                                     ADXL_POWER_CTL_AUTO_SLEEP);
     if (err) {
         LOG_ERROR("ADXL345_POWER_CTL ayarlama hatasi: %d", err);
         return err;
     }
 
-    /*!< ADXL345_THRESH_ACT Register: Aktivite threshold tanimlama */
-    err = write_reg(&spispec, ADXL345_THRESH_ACT, ADXL_THRESH_ACT_500MG);
-    if (err) {
-        LOG_ERROR("ADXL345_THRESH_ACT threshold ayarlama hatasi: %d", err);
-        return err;
-    }
-
-    /*!< ADXL345_THRESH_INT Register: Inaktivite threshold tanimlama */
-    err = write_reg(&spispec, ADXL345_THRESH_INT, ADXL_THRESH_INACT_500MG);
+    /*!< ADXL345_THRESH_ACT..ADXL345_ACT_INACT_CTL: ardisik dort register tek burst ile yazilir
+     *   - THRESH_ACT:    Aktivite threshold tanimlama
+     *   - THRESH_INACT:  Inaktivite threshold tanimlama
+     *   - TIME_INACT:    Uyku suresi ayari (yaklasik 10 sn)
+     *   - ACT_INACT_CTL: X, Y eksenleri aktivite/inaktivite DC mod ayari */
+    const uint8_t act_inact[] = {
+        adxl_config.thresh_act,
+        adxl_config.thresh_inact,
+        adxl_config.time_inact,
+        ADXL_ACT_INACT_CTL_ACT_X_ENABLE     |   ADXL_ACT_INACT_CTL_ACT_Y_ENABLE |
+        ADXL_ACT_INACT_CTL_INACT_X_ENABLE   |   ADXL_ACT_INACT_CTL_INACT_Y_ENABLE,
+    };
+
+    err = adxl345_write_regs(&adxl_bus, ADXL345_THRESH_ACT, act_inact, sizeof(act_inact));
     if (err) {
-        LOG_ERROR("ADXL345_THRESH_INT threshold ayarlama hatasi: %d", err);
+        LOG_ERROR("ADXL345_THRESH_ACT..ACT_INACT_CTL ayarlama hatasi: %d", err);
         return err;
     }
 
-    /*!< ADXL345_TIME_INACT Register: Uyku suresi ayari (yaklasik 10 sn) */
-    err = write_reg(&spispec, ADXL345_TIME_INACT, ADXL_TIME_INACT_10_SEC);
-    if (err) {
-        LOG_ERROR("ADXL345_TIME_INACT sure ayarlama hatasi: %d", err);
-        return err;
-    }
-
-    /*!< ADXL345_ACT_INACT_CTL Register: X, Y eksenleri aktivite/inaktivite DC mod ayari */
-    err = write_reg(&spispec,   ADXL345_ACT_INACT_CTL, 
-                                ADXL_ACT_INACT_CTL_ACT_X_ENABLE     |   ADXL_ACT_INACT_CTL_ACT_Y_ENABLE | 
-                                ADXL_ACT_INACT_CTL_INACT_X_ENABLE   |   ADXL_ACT_INACT_CTL_INACT_Y_ENABLE);
-    if (err) {
-        LOG_ERROR("ADXL345_ACT_INACT_CTL ayarlama hatasi: %d", err);
-        return err;
-    }
-
-    /*!< ADXL345_INT_MAP Register: Interrupt pin ayari (int2 uzerinden interrupt) */
-    err = write_reg(&spispec, ADXL345_INT_MAP,  ADXL_INT_MAP_ACTIVITY | 
-                                                ADXL_INT_MAP_INACTIVITY );
+    /*!< ADXL345_INT_MAP Register: Interrupt pin ayari. Tum kaynaklar bir kez eslenir;
+     *   INT1 tanimliysa veri kaynaklari ve olaylar ayri pinlere, degilse hepsi INT2'ye */
+    err = adxl345_write_reg(&adxl_bus, ADXL345_INT_MAP, ADXL_INT_MAP_ROUTE);
     if (err) {
         LOG_ERROR("ADXL345_INT_MAP pin ayarlama hatasi: %d", err);
         return err;
     }
 
     /*!< ADXL345_INT_ENABLE Register: Interruptlari etkinlestirme */
-    err = write_reg(&spispec, ADXL345_INT_ENABLE,   ADXL_INT_ENABLE_ACTIVITY | 
+    err = adxl345_write_reg(&adxl_bus, ADXL345_INT_ENABLE,   ADXL_INT_ENABLE_ACTIVITY | 
                                                     ADXL_INT_ENABLE_INACTIVITY );
     if (err) {
         LOG_ERROR("ADXL345_INT_ENABLE etkinlestirme hatasi: %d", err);
@@ -213,7 +341,7 @@ private int init_adxl_interrupt(void)
     }
 
     /*!< ADXL345_POWER_CTL Register: Olcum modu, link-bit ve auto-sleep etkinlestirme */
-    err = write_reg(&spispec, ADXL345_POWER_CTL,    ADXL_POWER_CTL_LINK         | 
+    err = adxl345_write_reg(&adxl_bus, ADXL345_POWER_CTL,    ADXL_POWER_CTL_LINK         | 
                                                     ADXL_POWER_CTL_AUTO_SLEEP   | 
                                                     ADXL_POWER_CTL_MEASURE );
     if (err) {
@@ -225,8 +353,8 @@ private int init_adxl_interrupt(void)
     LOG_INFO("ADXL345 yapilandirma basariyla tamamlandi.");
 
     uint8_t data[1];
-    spi_read_reg(&spispec , ADXL345_DEVID_REG , data , 1);
-    LOG_DEBUG("Spi device id : %d \n " , data[0]);
+    adxl345_read_reg(&adxl_bus , ADXL345_DEVID_REG , data , 1);
+    LOG_DEBUG("Device id : %d \n " , data[0]);
     return 0;
 
 }
@@ -234,6 +362,420 @@ private int init_adxl_interrupt(void)
 
 
 
+/**
+ * @brief DATAX0..DATAZ1 register'larindan tek bir ornegi burst olarak okur.
+ *
+ * Alti byte tek bir burst islemi ile okunur; boylece eksenler ayni
+ * ornege ait olur. Register'lar little-endian oldugu icin byte'lar birlestirilir.
+ *
+ * @param[out] sample   Okunan ham ornek (LSB).
+ * @return Basariliysa 0, aksi halde hata kodu.
+ */
+public int adxl345_read_sample(struct adxl345_sample *sample)
+{
+    uint8_t raw[ADXL345_SAMPLE_SIZE];
+    int err;
+
+    if (!sample) {
+        return -EINVAL;
+    }
+
+    err = adxl345_read_reg(&adxl_bus, ADXL345_DATAX0, raw, sizeof(raw));
+    if (err) {
+        return err;
+    }
+
+    sample->x = (int16_t)sys_get_le16(&raw[0]);
+    sample->y = (int16_t)sys_get_le16(&raw[2]);
+    sample->z = (int16_t)sys_get_le16(&raw[4]);
+    return 0;
+}
+
+/**
+ * @brief Ham ivme degerini mevcut DATA_FORMAT ayarina gore mg cinsine cevirir.
+ *
+ * Tekil okumalar icindir; FIFO bloklari icin blogun kendi DATA_FORMAT'i ile
+ * adxl345_lsb_shift() ve adxl345_lsb_to_mg() kullanilmalidir.
+ *
+ * @param raw   DATAx register'larindan okunan ham deger.
+ * @return mg cinsinden ivme.
+ */
+public int32_t adxl345_raw_to_mg(int16_t raw)
+{
+    return adxl345_lsb_to_mg(raw, adxl345_lsb_shift(adxl_config.data_format));
+}
+
+/**
+ * @brief Ham degeri FULL_RES LSB'sine (3.9 mg) tasiyan sola kaydirma miktari.
+ *
+ * FULL_RES modunda LSB agirligi range'den bagimsiz oldugu icin 0, 10-bit modda
+ * range degeridir. Kaydirilmis degerler her ayarda ±4096 icinde kalir.
+ */
+public uint8_t adxl345_lsb_shift(uint8_t data_format)
+{
+    return (data_format & ADXL_DATA_FORMAT_FULL_RES) ? 0 : (data_format & ADXL_DATA_FORMAT_RANGE_MASK);
+}
+
+/**
+ * @brief Verilen DATA_FORMAT icin ham degerin doyma siniri (LSB, mutlak deger).
+ */
+public uint16_t adxl345_full_scale_lsb(uint8_t data_format)
+{
+    uint8_t range = data_format & ADXL_DATA_FORMAT_RANGE_MASK;
+
+    return (data_format & ADXL_DATA_FORMAT_FULL_RES) ? (512 << range) : 512;
+}
+
+/**
+ * @brief Bir register'in yalnizca maskelenmis bitlerini degistirir (read-modify-write).
+ *
+ * INT_ENABLE ve INT_MAP gibi birden fazla modulun ortak kullandigi register'lar
+ * icin kullanilir; diger modullerin bitleri korunur. Okuma ve yazma tek bir
+ * BULK sinifi hat oturumunda yapilir.
+ *
+ * @param reg       Register adresi.
+ * @param mask      Degistirilecek bitler.
+ * @param value     Maskelenmis bitlerin yeni degeri.
+ * @return Basariliysa 0, aksi halde hata kodu.
+ */
+public int adxl345_update_reg(uint8_t reg, uint8_t mask, uint8_t value)
+{
+    uint8_t current;
+    int err;
+
+    k_mutex_lock(&adxl_config_lock, K_FOREVER);
+    spi_bus_acquire(&adxl_bus, SPI_BUS_CLASS_BULK, 0);
+    err = adxl345_read_reg(&adxl_bus, reg, &current, 1);
+    if (!err) {
+        err = adxl345_write_reg(&adxl_bus, reg, (current & ~mask) | (value & mask));
+    }
+    spi_bus_release();
+    k_mutex_unlock(&adxl_config_lock);
+
+    return err;
+}
+
+/**
+ * @brief FIFO_CTL register'ini yazar (mod, trigger pini ve watermark).
+ *
+ * @param fifo_ctl  ADXL_FIFO_CTL_MODE_* | watermark degeri.
+ * @return Basariliysa 0, aksi halde hata kodu.
+ */
+public int adxl345_fifo_configure(uint8_t fifo_ctl)
+{
+    spi_bus_acquire(&adxl_bus, SPI_BUS_CLASS_BULK, 0);
+    int err = adxl345_write_reg(&adxl_bus, ADXL345_FIFO_CTL, fifo_ctl);
+    spi_bus_release();
+
+    return err;
+}
+
+/**
+ * @brief FIFO'da biriken ornekleri okur.
+ *
+ * Once FIFO_STATUS ile ornek sayisi okunur, ardindan her ornek ayri bir
+ * 6 byte'lik burst ile alinir. ADXL345 bir burst icinde DATAZ1'den sonra
+ * bir sonraki FIFO girisine gecmedigi icin ornekler tek islemde okunamaz.
+ *
+ * @param[out] samples      Orneklerin yazilacagi dizi.
+ * @param[in]  max_count    Dizinin kapasitesi.
+ * @return Okunan ornek sayisi veya negatif hata kodu.
+ */
+public int adxl345_read_fifo(struct adxl345_sample *samples, uint8_t max_count)
+{
+    uint8_t status;
+    int err;
+
+    err = adxl345_read_reg(&adxl_bus, ADXL345_FIFO_STATUS, &status, 1);
+    if (err) {
+        return err;
+    }
+
+    uint8_t count = MIN(status & ADXL_FIFO_STATUS_ENTRIES_MASK, max_count);
+
+    for (uint8_t i = 0; i < count; i++) {
+        err = adxl345_read_sample(&samples[i]);
+        if (err) {
+            return err;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief BW_RATE degerine karsilik gelen cikis veri hizini dondurur.
+ *
+ * @param bw_rate   BW_RATE register degeri (LOW_POWER biti yok sayilir).
+ * @return ODR (mHz).
+ */
+public uint32_t adxl345_odr_mhz(uint8_t bw_rate)
+{
+    static const uint32_t odr_mhz[16] = {
+        100, 200, 390, 780, 1560, 3130, 6250, 12500,
+        25000, 50000, 100000, 200000, 400000, 800000, 1600000, 3200000,
+    };
+
+    return odr_mhz[bw_rate & ADXL_BW_RATE_3200HZ];
+}
+
+/**
+ * @brief Bir register'a yazar ve basariliysa onbellekteki ayari gunceller.
+ *
+ * @param reg       Yazilacak register adresi.
+ * @param value     Yazilacak deger.
+ * @param cached    Guncellenecek onbellek alani.
+ * @return Basariliysa 0, aksi halde hata kodu.
+ */
+private int write_config_reg( uint8_t reg , uint8_t value , uint8_t *cached )
+{
+    int err;
+
+    k_mutex_lock(&adxl_config_lock, K_FOREVER);
+    spi_bus_acquire(&adxl_bus, SPI_BUS_CLASS_BULK, 0);
+    err = adxl345_write_reg(&adxl_bus, reg, value);
+    spi_bus_release();
+    if (!err) {
+        *cached = value;
+    }
+    k_mutex_unlock(&adxl_config_lock);
+
+    return err;
+}
+
+/**
+ * @brief FIFO'daki ornekleri okuyup atar. Hat oturumu icinde cagrilir.
+ */
+private int discard_fifo( void )
+{
+    struct adxl345_sample scratch;
+    uint8_t status;
+    int err = adxl345_read_reg(&adxl_bus, ADXL345_FIFO_STATUS, &status, 1);
+
+    for (uint8_t i = 0; !err && i < (status & ADXL_FIFO_STATUS_ENTRIES_MASK); i++) {
+        err = adxl345_read_sample(&scratch);
+    }
+    return err;
+}
+
+/**
+ * @brief DATA_FORMAT'in `mask` bitlerini `bits` ile degistirir; gerekirse FIFO'yu atar.
+ *
+ * Oku-degistir-yaz ayar kilidi altinda yapilir; autorange ve shell'den es
+ * zamanli yazimlarda guncelleme kaybolmaz.
+ *
+ * Sensor FIFO'ya ornegi yakalandigi andaki DATA_FORMAT ile yazar. LSB agirligi
+ * (adxl345_lsb_shift) degismiyorsa (ornegin FULL_RES'te range degisimi) eski
+ * ornekler yeni etiketle dogru olceklenir ve korunur; autorange'in yukari
+ * gecisini tetikleyen darbe boylece kaybolmaz. Agirlik degisiyorsa FIFO'daki
+ * ornekler atilir; pipeline bunu bir sonraki blogun `overrun` bayragi ile
+ * bildirir. Yazma, bosaltma ve `fifo_data_format` guncellemesi tek bir hat
+ * oturumunda yapilir; pipeline'in bosaltmasi ile ic ice gecmez.
+ *
+ * @return Basariliysa 0, aksi halde hata kodu.
+ */
+private int write_data_format( uint8_t mask , uint8_t bits )
+{
+    int err;
+
+    k_mutex_lock(&adxl_config_lock, K_FOREVER);
+    uint8_t old = adxl_config.data_format;
+    uint8_t value = (old & ~mask) | (bits & mask);
+
+    spi_bus_acquire(&adxl_bus, SPI_BUS_CLASS_BULK, 0);
+    err = adxl345_write_reg(&adxl_bus, ADXL345_DATA_FORMAT, value);
+    if (!err) {
+        adxl_config.data_format = value;
+        fifo_data_format = value;
+        if (adxl345_lsb_shift(old) != adxl345_lsb_shift(value)) {
+            err = discard_fifo();
+        }
+    }
+    spi_bus_release();
+    k_mutex_unlock(&adxl_config_lock);
+
+    return err;
+}
+
+/**
+ * @brief FIFO'daki orneklerin yakalandigi DATA_FORMAT'i dondurur.
+ *
+ * FIFO'yu bosaltan hat oturumu icinde cagrilmalidir; boylece donen deger
+ * okunan orneklerin olcegidir. adxl345_get_config() bu noktada kullanilamaz
+ * (ayar kilidi hat oturumundan once alinir).
+ */
+public uint8_t adxl345_fifo_data_format(void)
+{
+    return fifo_data_format;
+}
+
+/**
+ * @brief BW_RATE register'ini (veri hizi ve LOW_POWER biti) calisma aninda degistirir.
+ *
+ * @param bw_rate   ADXL_BW_RATE_* degeri, istege bagli olarak ADXL_BW_RATE_LOW_POWER ile.
+ * @return Basariliysa 0, gecersiz degerde -EINVAL, aksi halde hata kodu.
+ */
+public int adxl345_set_bw_rate(uint8_t bw_rate)
+{
+    if (bw_rate & ~(ADXL_BW_RATE_LOW_POWER | ADXL_BW_RATE_3200HZ)) {
+        return -EINVAL;
+    }
+    return write_config_reg(ADXL345_BW_RATE, bw_rate, &adxl_config.bw_rate);
+}
+
+/**
+ * @brief DATA_FORMAT register'indaki range bitlerini degistirir, diger bitleri korur.
+ *
+ * @param range     ADXL_DATA_FORMAT_RANGE_* degeri.
+ * @return Basariliysa 0, gecersiz degerde -EINVAL, aksi halde hata kodu.
+ */
+public int adxl345_set_range(uint8_t range)
+{
+    if (range & ~ADXL_DATA_FORMAT_RANGE_MASK) {
+        return -EINVAL;
+    }
+    return write_data_format(ADXL_DATA_FORMAT_RANGE_MASK, range);
+}
+
+/**
+ * @brief FULL_RES bitini degistirir, range ve diger bitleri korur.
+ *
+ * FULL_RES modunda LSB agirligi her range'de 3.9 mg'dir (±16 g'de 13 bit).
+ */
+public int adxl345_set_full_res(bool enable)
+{
+    return write_data_format(ADXL_DATA_FORMAT_FULL_RES, enable ? ADXL_DATA_FORMAT_FULL_RES : 0);
+}
+
+/**
+ * @brief Aktivite esik degerini (62.5 mg/LSB) degistirir.
+ */
+public int adxl345_set_thresh_act(uint8_t thresh)
+{
+    return write_config_reg(ADXL345_THRESH_ACT, thresh, &adxl_config.thresh_act);
+}
+
+/**
+ * @brief Inaktivite esik degerini (62.5 mg/LSB) degistirir.
+ */
+public int adxl345_set_thresh_inact(uint8_t thresh)
+{
+    return write_config_reg(ADXL345_THRESH_INT, thresh, &adxl_config.thresh_inact);
+}
+
+/**
+ * @brief Inaktivite suresini (1 sn/LSB) degistirir.
+ */
+public int adxl345_set_time_inact(uint8_t seconds)
+{
+    return write_config_reg(ADXL345_TIME_INACT, seconds, &adxl_config.time_inact);
+}
+
+/**
+ * @brief Bir register'a ham deger yazar; ayar onbellegini tutarli tutar.
+ *
+ * Onbellekte tutulan register'lar (BW_RATE, DATA_FORMAT, THRESH_ACT,
+ * THRESH_INACT, TIME_INACT) ayarlayicilarin yolundan yazilir; DATA_FORMAT
+ * yaziminda FIFO da atilir. Diger register'lar BULK sinifinda dogrudan yazilir.
+ * Deger dogrulanmaz.
+ *
+ * @param reg       Register adresi.
+ * @param value     Yazilacak deger.
+ * @return Basariliysa 0, aksi halde hata kodu.
+ */
+public int adxl345_set_reg(uint8_t reg, uint8_t value)
+{
+    switch (reg) {
+    case ADXL345_BW_RATE:
+        return write_config_reg(reg, value, &adxl_config.bw_rate);
+    case ADXL345_DATA_FORMAT:
+        return write_data_format(0xFF, value);
+    case ADXL345_THRESH_ACT:
+        return write_config_reg(reg, value, &adxl_config.thresh_act);
+    case ADXL345_THRESH_INT:
+        return write_config_reg(reg, value, &adxl_config.thresh_inact);
+    case ADXL345_TIME_INACT:
+        return write_config_reg(reg, value, &adxl_config.time_inact);
+    default:
+        break;
+    }
+
+    spi_bus_acquire(&adxl_bus, SPI_BUS_CLASS_BULK, 0);
+    int err = adxl345_write_reg(&adxl_bus, reg, value);
+    spi_bus_release();
+
+    return err;
+}
+
+/**
+ * @brief Onbellekteki calisma ayarlarinin bir kopyasini dondurur.
+ *
+ * @param[out] config   Ayarlarin kopyalanacagi yapi.
+ */
+public void adxl345_get_config(struct adxl345_config *config)
+{
+    k_mutex_lock(&adxl_config_lock, K_FOREVER);
+    *config = adxl_config;
+    k_mutex_unlock(&adxl_config_lock);
+}
+
+/**
+ * @brief Hat performans sayaclarinin tutarli bir kopyasini dondurur.
+ *
+ * @param[out] stats    Sayaclarin kopyalanacagi yapi.
+ */
+public void adxl345_get_stats(struct adxl345_stats *stats)
+{
+    k_spinlock_key_t key = k_spin_lock(&adxl_stats_lock);
+
+    *stats = adxl_stats;
+    k_spin_unlock(&adxl_stats_lock, key);
+}
+
+/**
+ * @brief Hat performans sayaclarini sifirlar.
+ */
+public void adxl345_reset_stats(void)
+{
+    k_spinlock_key_t key = k_spin_lock(&adxl_stats_lock);
+
+    memset(&adxl_stats, 0, sizeof(adxl_stats));
+    k_spin_unlock(&adxl_stats_lock, key);
+}
+
+/**
+ * @brief Guc durumu surelerinin bir kopyasini dondurur; devam eden durum dahildir.
+ *
+ * @param[out] res  Surelerin kopyalanacagi yapi.
+ */
+public void adxl345_get_residency(struct adxl345_residency *res)
+{
+    k_spinlock_key_t key = k_spin_lock(&adxl_stats_lock);
+    int64_t now = k_uptime_ticks();
+
+    for (int i = 0; i < ADXL345_PSTATE_COUNT; i++) {
+        uint64_t ticks = residency_ticks[i] + ((i == residency_state) ? (uint64_t)(now - residency_since) : 0);
+
+        res->us[i] = k_ticks_to_us_floor64(ticks);
+    }
+    res->transitions = residency_transitions;
+    res->state = residency_state;
+    k_spin_unlock(&adxl_stats_lock, key);
+}
+
+/**
+ * @brief Guc durumu surelerini sifirlar; izlenen durum korunur.
+ */
+public void adxl345_reset_residency(void)
+{
+    k_spinlock_key_t key = k_spin_lock(&adxl_stats_lock);
+
+    memset(residency_ticks, 0, sizeof(residency_ticks));
+    residency_transitions = 0;
+    residency_since = k_uptime_ticks();
+    k_spin_unlock(&adxl_stats_lock, key);
+}
+
+
 private int adxl345_init_func(const struct device *dev)
 {
     ARG_UNUSED(dev); 
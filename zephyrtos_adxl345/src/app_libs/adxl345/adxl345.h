@@ -13,7 +13,7 @@ extern "C" {
 #endif
 
 #include "utils.h"
-#include<zephyr/drivers/spi.h>
+#include "adxl345_bus.h"
 
 /**
  * @brief ADXL init fonksiyonu öncelik seviyesi.
@@ -21,20 +21,6 @@ extern "C" {
 #define ADXL345_INIT_PRIORITY 71
 
 
-/** 
- * @brief SPI Ayarları 
- * 8 bit veri, MSB (Most Significant Bit) ilk gönderilir, CPOL=1 ve CPHA=1.
- * Bu ayarlar, ADXL345 sensörünün SPI iletişimi için gereklidir.
- */
-#define SPIOP                     (SPI_WORD_SET(8) | SPI_TRANSFER_MSB | SPI_MODE_CPOL | SPI_MODE_CPHA)
-
-/** 
- * @brief ADXL345 Okuma ve Multi-Byte Bit Tanımları
- * ADXL345 cihazına SPI üzerinden okuma ve çoklu veri aktarımı için tanımlamalar.
- */
-#define ADXL_SPI_READ             0x80 /*!< Register okuma işlemi için gerekli bit */
-#define ADXL_SPI_MB               0x40 /*!< Çoklu (multi-byte) okuma/yazma işlemleri için bit */
-
 /** 
  * @brief ADXL345 Register Adresleri 
  * ADXL345 sensöründe bulunan register (yazma/okuma yapılabilen adresler) tanımları.
@@ -51,6 +37,13 @@ extern "C" {
 #define ADXL345_BW_RATE           0x2C /*!< Bant genişliği ve veri hızı register adresi */ 
 #define ADXL345_DATA_FORMAT       0x31 /*!< Veri formatı ayarları register adresi */ 
 #define ADXL345_ID_DEVID          0xE5 /*!< Cihaz kimliği (Device ID) register adresi */
+#define ADXL345_DATAX0            0x32 /*!< X ekseni veri register'i (LSB), DATAX0..DATAZ1 burst okunur */
+#define ADXL345_FIFO_CTL          0x38 /*!< FIFO kontrol register adresi */
+#define ADXL345_FIFO_STATUS       0x39 /*!< FIFO durum register adresi */
+#define ADXL345_REG_MAX           0x39 /*!< Gecerli son register adresi */
+
+/** @brief Bir ornek (X, Y, Z) icin DATAX0..DATAZ1 arasindaki byte sayisi */
+#define ADXL345_SAMPLE_SIZE       6
 
 
 /** @brief POWER_CTL Register Bit Tanımlamaları */
@@ -176,6 +169,45 @@ extern "C" {
 #define ADXL_DATA_FORMAT_RANGE_4G        0x01 /*!< ±4g */
 #define ADXL_DATA_FORMAT_RANGE_8G        0x02 /*!< ±8g */
 #define ADXL_DATA_FORMAT_RANGE_16G       0x03 /*!< ±16g */
+#define ADXL_DATA_FORMAT_RANGE_MASK      0x03 /*!< Range bitleri maskesi */
+#define ADXL_DATA_FORMAT_JUSTIFY         0x04 /*!< Sola dayali (MSB) veri */
+#define ADXL_DATA_FORMAT_FULL_RES        0x08 /*!< Full resolution modu */
+#define ADXL_DATA_FORMAT_INT_INVERT      0x20 /*!< Interrupt pinleri aktif-low */
+#define ADXL_DATA_FORMAT_SPI_3WIRE       0x40 /*!< 3 telli SPI modu */
+#define ADXL_DATA_FORMAT_SELF_TEST       0x80 /*!< Self-test kuvveti uygula */
+
+/** @brief FIFO_CTL Register Bit Tanımlamaları */
+#define ADXL_FIFO_CTL_MODE_BYPASS        0x00 /*!< FIFO kapali                              */
+#define ADXL_FIFO_CTL_MODE_FIFO          0x40 /*!< FIFO dolunca ornekleme durur             */
+#define ADXL_FIFO_CTL_MODE_STREAM        0x80 /*!< FIFO dolunca en eski ornek silinir       */
+#define ADXL_FIFO_CTL_MODE_TRIGGER       0xC0 /*!< Tetiklemeden once son N ornek saklanir   */
+#define ADXL_FIFO_CTL_MODE_MASK          0xC0 /*!< FIFO mod bitleri maskesi                 */
+#define ADXL_FIFO_CTL_TRIGGER_INT2       0x20 /*!< Trigger olayi INT2'ye bagli (0: INT1)    */
+#define ADXL_FIFO_CTL_SAMPLES_MASK       0x1F /*!< Watermark / pre-trigger ornek sayisi     */
+
+/** @brief FIFO_STATUS Register Bit Tanımlamaları */
+#define ADXL_FIFO_STATUS_TRIGGER         0x80 /*!< Trigger olayi gerceklesti                */
+#define ADXL_FIFO_STATUS_ENTRIES_MASK    0x3F /*!< FIFO'daki ornek sayisi                   */
+
+/** @brief Donanim FIFO derinligi (ornek) */
+#define ADXL345_FIFO_DEPTH               32
+
+/**
+ * @brief ±2g, 10-bit modda ve FULL_RES modunda LSB agirligi (µg/LSB).
+ * 10-bit modda her range adiminda iki katina cikar; FULL_RES modunda sabittir,
+ * range yalnizca doyma sinirini (512 << range LSB) belirler.
+ */
+#define ADXL_DATA_SCALE_UG               3906
+
+/** 
+ * @brief Varsayilan sensor ayarlari
+ * Acilista yazilan degerlerdir; calisma aninda adxl345_set_*() fonksiyonlari ile degistirilebilir.
+ */
+#define ADXL345_DEFAULT_BW_RATE          ADXL_BW_RATE_0_10HZ
+#define ADXL345_DEFAULT_DATA_FORMAT      (ADXL_DATA_FORMAT_FULL_RES | ADXL_DATA_FORMAT_RANGE_2G)
+#define ADXL345_DEFAULT_THRESH_ACT       ADXL_THRESH_ACT_500MG
+#define ADXL345_DEFAULT_THRESH_INACT     ADXL_THRESH_INACT_500MG
+#define ADXL345_DEFAULT_TIME_INACT       ADXL_TIME_INACT_10_SEC
 
 
 
@@ -187,8 +219,88 @@ extern "C" {
 #define ADXL345_INACT_INTERRUPT_MASK    0x08 /*!< İnaktivite algılama interrupt biti */
 
 
-public int spi_read_reg( const struct spi_dt_spec *spispec , uint8_t reg , uint8_t *data , uint8_t size );
-public struct spi_dt_spec* get_spi_device(void);
+/** @brief DATAX0..DATAZ1 register'larindan okunan ham ornek (LSB) */
+struct adxl345_sample {
+    int16_t x;
+    int16_t y;
+    int16_t z;
+};
+
+/** @brief Surucunun onbellekte tuttugu calisma ayarlari */
+struct adxl345_config {
+    uint8_t bw_rate;        /*!< BW_RATE register degeri            */
+    uint8_t data_format;    /*!< DATA_FORMAT register degeri        */
+    uint8_t thresh_act;     /*!< THRESH_ACT (62.5 mg/LSB)           */
+    uint8_t thresh_inact;   /*!< THRESH_INACT (62.5 mg/LSB)         */
+    uint8_t time_inact;     /*!< TIME_INACT (1 sn/LSB)              */
+};
+
+/** @brief Hat (SPI/I2C) islem sayaclari (performans istatistikleri) */
+struct adxl345_stats {
+    uint32_t read_count;    /*!< Okuma islemi sayisi                */
+    uint32_t write_count;   /*!< Yazma islemi sayisi                */
+    uint32_t error_count;   /*!< Basarisiz islem sayisi             */
+    uint32_t bytes;         /*!< Aktarilan toplam veri byte'i       */
+    uint64_t wire_bits;     /*!< Hatta gecen toplam bit (saat)      */
+    uint32_t max_cycles;    /*!< En uzun islem suresi (cycle)       */
+    uint64_t total_cycles;  /*!< Islemlerde gecen toplam sure       */
+};
+
+/**
+ * @brief Sensor guc durumlari (durum basina sure dizisinin indeksi).
+ *
+ * 0..31: olcum modunda ve uyanik; indeks BW_RATE'in hiz ve LOW_POWER bitleridir.
+ */
+#define ADXL345_PSTATE_SLEEP        32  /*!< Uyku (POWER_CTL SLEEP biti veya auto-sleep) */
+#define ADXL345_PSTATE_STANDBY      33  /*!< Standby (MEASURE biti kapali)               */
+#define ADXL345_PSTATE_COUNT        34
+
+/** @brief Sensorun guc durumlarinda gecirdigi sure */
+struct adxl345_residency {
+    uint64_t us[ADXL345_PSTATE_COUNT];  /*!< Durum basina sure (us)         */
+    uint32_t transitions;               /*!< Durum degisikligi sayisi       */
+    uint8_t state;                      /*!< Su anki durum                  */
+};
+
+public int adxl345_read_reg( const struct adxl345_bus *bus , uint8_t reg , uint8_t *data , uint8_t size );
+public int adxl345_write_reg( const struct adxl345_bus *bus , uint8_t reg , uint8_t value );
+public int adxl345_write_regs( const struct adxl345_bus *bus , uint8_t reg , const uint8_t *data , uint8_t size );
+public const struct adxl345_bus *adxl345_get_bus(void);
+
+public int adxl345_read_sample(struct adxl345_sample *sample);
+public int32_t adxl345_raw_to_mg(int16_t raw);
+public uint8_t adxl345_lsb_shift(uint8_t data_format);
+public uint16_t adxl345_full_scale_lsb(uint8_t data_format);
+
+public int adxl345_set_bw_rate(uint8_t bw_rate);
+public int adxl345_set_range(uint8_t range);
+public int adxl345_set_full_res(bool enable);
+public int adxl345_set_thresh_act(uint8_t thresh);
+public int adxl345_set_thresh_inact(uint8_t thresh);
+public int adxl345_set_time_inact(uint8_t seconds);
+public int adxl345_set_reg(uint8_t reg, uint8_t value);
+public void adxl345_get_config(struct adxl345_config *config);
+public uint8_t adxl345_fifo_data_format(void);
+
+public int adxl345_update_reg(uint8_t reg, uint8_t mask, uint8_t value);
+public int adxl345_fifo_configure(uint8_t fifo_ctl);
+public int adxl345_read_fifo(struct adxl345_sample *samples, uint8_t max_count);
+public uint32_t adxl345_odr_mhz(uint8_t bw_rate);
+
+public void adxl345_get_stats(struct adxl345_stats *stats);
+public void adxl345_reset_stats(void);
+public void adxl345_get_residency(struct adxl345_residency *res);
+public void adxl345_reset_residency(void);
+
+/**
+ * @brief Ham degeri mg'ye cevirir; `shift` adxl345_lsb_shift() ile blok basina bir kez hesaplanir.
+ *
+ * Ornek basina dallanma yoktur; FULL_RES ve 10-bit modlar yalnizca `shift` ile ayrilir.
+ */
+static inline int32_t adxl345_lsb_to_mg(int16_t raw, uint8_t shift)
+{
+    return ((int32_t)raw * (ADXL_DATA_SCALE_UG << shift)) / 1000;
+}
 
 
 #ifdef __cplusplus
@@ -0,0 +1,104 @@
+/**
+ * @file adxl345_bus.h
+ * @brief ADXL345 register erisimi icin SPI/I2C tasima katmani
+ *
+ * Tasima, `mysensor1` dugumunun devicetree'de bagli oldugu hatta gore derleme
+ * aninda secilir; fonksiyon isaretcisi yoktur, secilmeyen tasimanin kodu
+ * derlenmez. Her iki tasima da cok byte'li (burst) okuma ve yazmayi destekler:
+ * SPI'da komut byte'indaki MB biti, I2C'de cihazin adres otomatik artirimi ile.
+ *
+ * Hat paylasimi (spi_bus oturumlari) ve sayaclar tasimadan bagimsizdir ve
+ * adxl345.c'de kalir.
+ */
+#ifndef ADXL345_BUS_H
+#define ADXL345_BUS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "utils.h"
+#include <zephyr/devicetree.h>
+
+/** @brief Sensorun devicetree dugumu */
+#define ADXL345_NODE                DT_NODELABEL(mysensor1)
+
+/** @brief Tasima turleri; ADXL345_BUS_TYPE derlenen tasimayi verir */
+enum adxl345_bus_type {
+    ADXL345_BUS_TYPE_SPI = 0,
+    ADXL345_BUS_TYPE_I2C,
+};
+
+#if DT_ON_BUS(ADXL345_NODE, i2c)
+#include <zephyr/drivers/i2c.h>
+
+#define ADXL345_BUS_I2C             1
+#define ADXL345_BUS_TYPE            ADXL345_BUS_TYPE_I2C
+#define ADXL345_BUS_FREQ_HZ         DT_PROP_OR(DT_BUS(ADXL345_NODE), clock_frequency, I2C_BITRATE_STANDARD)
+#define ADXL345_BUS_DT_SPEC_NODE(node)  { .i2c = I2C_DT_SPEC_GET(node) }
+#else
+#include <zephyr/drivers/spi.h>
+
+#define ADXL345_BUS_SPI             1
+#define ADXL345_BUS_TYPE            ADXL345_BUS_TYPE_SPI
+#define ADXL345_BUS_FREQ_HZ         DT_PROP(ADXL345_NODE, spi_max_frequency)
+#define ADXL345_BUS_DT_SPEC_NODE(node)  { .spi = SPI_DT_SPEC_GET(node, SPIOP, 0) }
+#endif
+
+/** @brief Sensorun hat tanimi; ayni hattaki baska bir ADXL345 icin ADXL345_BUS_DT_SPEC_NODE */
+#define ADXL345_BUS_DT_SPEC         ADXL345_BUS_DT_SPEC_NODE(ADXL345_NODE)
+
+/**
+ * @brief SPI Ayarları
+ * 8 bit veri, MSB (Most Significant Bit) ilk gönderilir, CPOL=1 ve CPHA=1.
+ * Bu ayarlar, ADXL345 sensörünün SPI iletişimi için gereklidir.
+ */
+#define SPIOP                     (SPI_WORD_SET(8) | SPI_TRANSFER_MSB | SPI_MODE_CPOL | SPI_MODE_CPHA)
+
+/**
+ * @brief ADXL345 Okuma ve Multi-Byte Bit Tanımları
+ * ADXL345 cihazına SPI üzerinden okuma ve çoklu veri aktarımı için tanımlamalar.
+ */
+#define ADXL_SPI_READ             0x80 /*!< Register okuma işlemi için gerekli bit */
+#define ADXL_SPI_MB               0x40 /*!< Çoklu (multi-byte) okuma/yazma işlemleri için bit */
+
+/** @brief I2C'de tek islemde yazilabilecek en fazla veri byte'i (adres byte'i ile tek tampon) */
+#define ADXL345_BUS_WRITE_MAX       16
+
+/** @brief Sensore giden hat; yalnizca derlenen tasimanin alani vardir */
+struct adxl345_bus {
+#if ADXL345_BUS_I2C
+    struct i2c_dt_spec i2c;
+#else
+    struct spi_dt_spec spi;
+#endif
+};
+
+/**
+ * @brief Bir register isleminin hatta kapladigi bit sayisi (saat periyodu).
+ *
+ * SPI: komut byte'i + veri, byte basina 8 saat.
+ * I2C: okuma adres(W) + register + adres(R) + veri, yazma adres(W) + register
+ * + veri; byte basina 9 saat (ACK) ve START/RESTART/STOP icin birer saat.
+ *
+ * @param type  Tasima turu; derlenmeyen tasima icin de hesaplanabilir (karsilastirma).
+ * @param read  Okuma ise true.
+ * @param size  Veri byte sayisi.
+ */
+static inline uint32_t adxl345_bus_wire_bits(enum adxl345_bus_type type, bool read, uint8_t size)
+{
+    if (type == ADXL345_BUS_TYPE_I2C) {
+        return read ? (3U + size) * 9U + 3U : (2U + size) * 9U + 2U;
+    }
+    return (1U + size) * 8U;
+}
+
+public bool adxl345_bus_is_ready(const struct adxl345_bus *bus);
+public int adxl345_bus_read(const struct adxl345_bus *bus, uint8_t reg, uint8_t *data, uint8_t size);
+public int adxl345_bus_write(const struct adxl345_bus *bus, uint8_t reg, const uint8_t *data, uint8_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ADXL345_BUS_H
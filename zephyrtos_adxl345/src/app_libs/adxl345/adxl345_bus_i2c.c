@@ -0,0 +1,47 @@
+#include "adxl345_bus.h"
+#include <string.h>
+
+#if ADXL345_BUS_I2C
+
+/**
+ * @brief I2C tasimasinin hazir olup olmadigini dondurur.
+ */
+public bool adxl345_bus_is_ready(const struct adxl345_bus *bus)
+{
+    return i2c_is_ready_dt(&bus->i2c);
+}
+
+/**
+ * @brief I2C uzerinden register okur.
+ *
+ * Register adresi yazilir, RESTART ile veri okunur. ADXL345 cok byte'li
+ * okumada adresi kendisi artirdigi icin SPI'daki MB bitinin karsiligi yoktur;
+ * DATAX0..DATAZ1 burst'u ayni sekilde tek islemdir.
+ */
+public int adxl345_bus_read(const struct adxl345_bus *bus, uint8_t reg, uint8_t *data, uint8_t size)
+{
+    return i2c_write_read_dt(&bus->i2c, &reg, 1, data, size);
+}
+
+/**
+ * @brief I2C uzerinden bir veya ardisik birden fazla register'a yazar.
+ *
+ * Adres ve veri tek tamponda gonderilir: iki ayri yazma mesajini RESTART'siz
+ * birlestiremeyen denetleyicilerde (i2c_burst_write) de calisir.
+ *
+ * @return Basariliysa 0, `size` ADXL345_BUS_WRITE_MAX'i asarsa -EINVAL, aksi halde hata kodu.
+ */
+public int adxl345_bus_write(const struct adxl345_bus *bus, uint8_t reg, const uint8_t *data, uint8_t size)
+{
+    uint8_t buf[1 + ADXL345_BUS_WRITE_MAX];
+
+    if (size > ADXL345_BUS_WRITE_MAX) {
+        return -EINVAL;
+    }
+    buf[0] = reg;
+    memcpy(&buf[1], data, size);
+
+    return i2c_write_dt(&bus->i2c, buf, 1 + size);
+}
+
+#endif
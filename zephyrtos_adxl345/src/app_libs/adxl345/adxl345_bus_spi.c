@@ -0,0 +1,58 @@
+#include "adxl345_bus.h"
+
+#if ADXL345_BUS_SPI
+
+/**
+ * @brief SPI tasimasinin hazir olup olmadigini dondurur.
+ */
+public bool adxl345_bus_is_ready(const struct adxl345_bus *bus)
+{
+    return spi_is_ready_dt(&bus->spi);
+}
+
+/**
+ * @brief SPI uzerinden register okur.
+ *
+ * Komut byte'ina okuma biti (0x80), birden fazla byte okunuyorsa multi-byte
+ * biti (0x40) eklenir. Komut byte'i suresince gelen byte atilir.
+ *
+ * @param bus   Sensor hatti.
+ * @param reg   Okunacak ilk register adresi.
+ * @param data  Okunan verinin yazilacagi buffer.
+ * @param size  Okunacak byte sayisi.
+ * @return Basariliysa 0, aksi halde hata kodu.
+ */
+public int adxl345_bus_read(const struct adxl345_bus *bus, uint8_t reg, uint8_t *data, uint8_t size)
+{
+    uint8_t cmd = reg | ADXL_SPI_READ | ((size > 1) ? ADXL_SPI_MB : 0);
+
+    struct spi_buf tx_spi_buf = {.buf = &cmd, .len = 1};
+    struct spi_buf_set tx_spi_buf_set = {.buffers = &tx_spi_buf, .count = 1};
+    struct spi_buf rx_spi_bufs[2] = {
+        {.buf = NULL, .len = 1},
+        {.buf = data, .len = size},
+    };
+    struct spi_buf_set rx_spi_buf_set = {.buffers = rx_spi_bufs, .count = 2};
+
+    return spi_transceive_dt(&bus->spi, &tx_spi_buf_set, &rx_spi_buf_set);
+}
+
+/**
+ * @brief SPI uzerinden bir veya ardisik birden fazla register'a yazar.
+ *
+ * Komut byte'i ve veri ayri buffer'lardan tek bir islemde gonderilir; kopya yapilmaz.
+ */
+public int adxl345_bus_write(const struct adxl345_bus *bus, uint8_t reg, const uint8_t *data, uint8_t size)
+{
+    uint8_t cmd = reg | ((size > 1) ? ADXL_SPI_MB : 0);
+
+    struct spi_buf tx_spi_bufs[2] = {
+        {.buf = &cmd, .len = 1},
+        {.buf = (uint8_t *)data, .len = size},
+    };
+    struct spi_buf_set tx_spi_buf_set = {.buffers = tx_spi_bufs, .count = 2};
+
+    return spi_write_dt(&bus->spi, &tx_spi_buf_set);
+}
+
+#endif
@@ -0,0 +1,609 @@
+/**
+ * @file adxl345_emul.c
+ * @brief native_sim icin ADXL345 SPI/I2C emulatoru
+ *
+ * `zephyr,spi-emul-controller` veya `zephyr,i2c-emul-controller` uzerindeki
+ * `adi,adxl345` dugumune baglanir; tasima surucudeki gibi devicetree'den
+ * derleme aninda secilir. Surucu gercek donanimdaki ile ayni SPI komutlarini
+ * veya I2C mesajlarini gonderir; emulator bunlari register dosyasi uzerinde
+ * yorumlar.
+ */
+#define DT_DRV_COMPAT adi_adxl345
+
+#include "adxl345_emul.h"
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/spi_emul.h>
+#include <zephyr/drivers/i2c_emul.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/drivers/gpio/gpio_emul.h>
+#include <zephyr/sys/byteorder.h>
+#include <string.h>
+
+LOG_MODULE_REGISTER(adxl345_emul, LOG_LEVEL_INF);
+
+/** @brief Emulatorun ornek uretme periyodu (ms) */
+#define ADXL_EMUL_TICK_MS           10
+
+/** @brief SPI isleminde islenebilecek en fazla byte sayisi */
+#define ADXL_EMUL_XFER_MAX          (ADXL345_REG_MAX + 2)
+
+/** @brief INT_SOURCE okununca temizlenen olay bitleri */
+#define EMUL_INT_LATCHED            (ADXL_INT_SOURCE_SINGLE_TAP | ADXL_INT_SOURCE_DOUBLE_TAP | \
+                                     ADXL_INT_SOURCE_ACTIVITY   | ADXL_INT_SOURCE_INACTIVITY | \
+                                     ADXL_INT_SOURCE_FREE_FALL)
+
+/** @brief Uyku modundaki ornekleme hizlari (POWER_CTL wakeup bitleri, mHz) */
+static const uint32_t emul_wakeup_mhz[4] = { 8000, 4000, 2000, 1000 };
+
+static const struct adxl345_sample emul_default_trace[] = {
+    { .x = 0, .y = 0, .z = 1000 },
+};
+
+struct adxl345_emul_data {
+    uint8_t regs[ADXL345_REG_MAX + 1];
+    struct adxl345_sample fifo[ADXL345_FIFO_DEPTH];
+    uint8_t fifo_head;
+    uint8_t fifo_count;
+    bool triggered;
+    bool inactive;
+    uint32_t below_inact;
+    struct adxl345_sample act_ref;      /*!< AC aktivite referansi (mg)                  */
+    struct adxl345_sample inact_ref;    /*!< AC inaktivite referansi (mg)                */
+    bool act_ref_valid;
+    bool inact_ref_valid;
+    uint64_t sample_acc;
+
+    const struct adxl345_sample *trace;
+    uint32_t trace_len;
+    uint32_t trace_pos;
+    uint32_t trace_rate_mhz;
+    uint64_t trace_acc;
+
+    bool primary;                   /*!< Uygulamanin sensoru; INT pinlerini yalnizca o surer */
+    struct k_timer timer;
+    struct k_spinlock lock;
+};
+
+/** @brief ADXL345_NODE'un emulatoru; iz ayarlari buna uygulanir */
+static struct adxl345_emul_data *emul_primary;
+
+#if DT_NODE_EXISTS(DT_ALIAS(adxl_select))
+static const struct gpio_dt_spec emul_int2 = GPIO_DT_SPEC_GET(DT_ALIAS(adxl_select), gpios);
+#endif
+#if DT_NODE_EXISTS(DT_ALIAS(adxl_int1))
+static const struct gpio_dt_spec emul_int1 = GPIO_DT_SPEC_GET(DT_ALIAS(adxl_int1), gpios);
+#endif
+
+
+/**
+ * @brief mg cinsindeki ivmeyi gecerli DATA_FORMAT ayarina gore ham LSB degerine cevirir.
+ */
+private int16_t emul_mg_to_raw( const struct adxl345_emul_data *data , int16_t mg )
+{
+    uint8_t format = data->regs[ADXL345_DATA_FORMAT];
+    uint8_t range = format & ADXL_DATA_FORMAT_RANGE_MASK;
+    int32_t raw;
+    int32_t limit;
+
+    if (format & ADXL_DATA_FORMAT_FULL_RES) {
+        raw = ((int32_t)mg * 1000) / ADXL_DATA_SCALE_UG;
+        limit = 512 << range;
+    } else {
+        raw = ((int32_t)mg * 1000) / (ADXL_DATA_SCALE_UG << range);
+        limit = 512;
+    }
+
+    return (int16_t)CLAMP(raw, -limit, limit - 1);
+}
+
+/**
+ * @brief FIFO'daki en eski ornegi DATAX0..DATAZ1 register'larina tasir.
+ */
+private void emul_fifo_pop( struct adxl345_emul_data *data )
+{
+    if (data->fifo_count == 0) {
+        return;
+    }
+
+    const struct adxl345_sample *s = &data->fifo[data->fifo_head];
+
+    sys_put_le16(s->x, &data->regs[ADXL345_DATAX0]);
+    sys_put_le16(s->y, &data->regs[ADXL345_DATAX0 + 2]);
+    sys_put_le16(s->z, &data->regs[ADXL345_DATAX0 + 4]);
+
+    data->fifo_head = (data->fifo_head + 1) % ADXL345_FIFO_DEPTH;
+    data->fifo_count--;
+}
+
+/**
+ * @brief Yeni bir ornegi gecerli FIFO moduna gore FIFO'ya ekler.
+ */
+private void emul_fifo_push( struct adxl345_emul_data *data , const struct adxl345_sample *s )
+{
+    uint8_t mode = data->regs[ADXL345_FIFO_CTL] & ADXL_FIFO_CTL_MODE_MASK;
+
+    if (data->fifo_count == ADXL345_FIFO_DEPTH) {
+        if (mode == ADXL_FIFO_CTL_MODE_FIFO || (mode == ADXL_FIFO_CTL_MODE_TRIGGER && data->triggered)) {
+            data->regs[ADXL345_INT_SOURCE] |= ADXL_INT_SOURCE_OVERRUN;
+            return;
+        }
+        data->fifo_head = (data->fifo_head + 1) % ADXL345_FIFO_DEPTH;
+        data->fifo_count--;
+        data->regs[ADXL345_INT_SOURCE] |= ADXL_INT_SOURCE_OVERRUN;
+    }
+
+    if (mode == ADXL_FIFO_CTL_MODE_BYPASS) {
+        data->fifo_head = 0;
+        data->fifo_count = 0;
+    }
+
+    uint8_t tail = (data->fifo_head + data->fifo_count) % ADXL345_FIFO_DEPTH;
+
+    data->fifo[tail] = *s;
+    data->fifo_count++;
+}
+
+/**
+ * @brief FIFO trigger modunda tetikleme aninda son N ornek disindakileri atar.
+ */
+private void emul_fifo_trigger( struct adxl345_emul_data *data )
+{
+    uint8_t keep = data->regs[ADXL345_FIFO_CTL] & ADXL_FIFO_CTL_SAMPLES_MASK;
+
+    while (data->fifo_count > keep) {
+        data->fifo_head = (data->fifo_head + 1) % ADXL345_FIFO_DEPTH;
+        data->fifo_count--;
+    }
+    data->triggered = true;
+}
+
+/**
+ * @brief Bir eksen ivmesinin esik degerini asip asmadigini kontrol eder (DC mod).
+ */
+private bool emul_axis_over( int32_t mg , uint8_t thresh )
+{
+    return (ABS(mg) * 2) > ((int32_t)thresh * 125);
+}
+
+/**
+ * @brief Etkin eksenlerden biri esigi asiyor mu; AC modda referanstan fark alinir.
+ *
+ * @param en    X, Y, Z etkinlestirme bitleri (ACT veya INACT konumunda).
+ * @param ref   AC modda referans, DC modda NULL.
+ */
+private bool emul_over( const struct adxl345_sample *mg , const struct adxl345_sample *ref ,
+                        uint8_t ctl , uint8_t x_en , uint8_t thresh )
+{
+    int32_t d[3] = { mg->x, mg->y, mg->z };
+
+    if (ref) {
+        d[0] -= ref->x;
+        d[1] -= ref->y;
+        d[2] -= ref->z;
+    }
+    return ((ctl & x_en) && emul_axis_over(d[0], thresh)) ||
+           ((ctl & (x_en >> 1)) && emul_axis_over(d[1], thresh)) ||
+           ((ctl & (x_en >> 2)) && emul_axis_over(d[2], thresh));
+}
+
+/**
+ * @brief Yeni ornege gore aktivite/inaktivite olaylarini degerlendirir.
+ *
+ * Link biti acikken aktivite yalnizca inaktiviteden sonra, inaktivite yalnizca
+ * aktiviteden sonra raporlanir.
+ *
+ * AC modda (datasheet, ACT_INACT_CTL) aktivite referansi algilamanin
+ * basindaki ornektir: olcum baslarken, ACT_INACT_CTL yazildiginda ve link
+ * modunda inaktivite raporlandiktan sonra yenilenir. Inaktivite referansi,
+ * ivme inaktivite esigini her astiginda yenilenir.
+ */
+private void emul_detect_motion( struct adxl345_emul_data *data , const struct adxl345_sample *mg , uint32_t odr_mhz )
+{
+    uint8_t ctl = data->regs[ADXL345_ACT_INACT_CTL];
+    uint8_t act = data->regs[ADXL345_THRESH_ACT];
+    uint8_t inact = data->regs[ADXL345_THRESH_INT];
+    bool link = data->regs[ADXL345_POWER_CTL] & ADXL_POWER_CTL_LINK;
+
+    bool act_ac = ctl & ADXL_ACT_INACT_CTL_ACT_AC_DC;
+    bool inact_ac = ctl & ADXL_ACT_INACT_CTL_INACT_AC_DC;
+
+    if (act_ac && !data->act_ref_valid) {
+        data->act_ref = *mg;
+        data->act_ref_valid = true;
+    }
+    if (inact_ac && !data->inact_ref_valid) {
+        data->inact_ref = *mg;
+        data->inact_ref_valid = true;
+    }
+
+    bool over_act = emul_over(mg, act_ac ? &data->act_ref : NULL, ctl, ADXL_ACT_INACT_CTL_ACT_X_ENABLE, act);
+    bool over_inact = emul_over(mg, inact_ac ? &data->inact_ref : NULL, ctl, ADXL_ACT_INACT_CTL_INACT_X_ENABLE,
+                                inact);
+
+    if (inact_ac && over_inact) {
+        data->inact_ref = *mg;
+    }
+
+    if (over_act && (!link || data->inactive)) {
+        data->regs[ADXL345_INT_SOURCE] |= ADXL_INT_SOURCE_ACTIVITY;
+        data->inactive = false;
+        if ((data->regs[ADXL345_FIFO_CTL] & ADXL_FIFO_CTL_MODE_MASK) == ADXL_FIFO_CTL_MODE_TRIGGER &&
+            !data->triggered) {
+            emul_fifo_trigger(data);
+        }
+    }
+
+    data->below_inact = over_inact ? 0 : data->below_inact + 1;
+
+    uint64_t needed = ((uint64_t)data->regs[ADXL345_TIME_INACT] * odr_mhz) / 1000U;
+
+    if (!data->inactive && data->below_inact > needed) {
+        data->regs[ADXL345_INT_SOURCE] |= ADXL_INT_SOURCE_INACTIVITY;
+        data->inactive = true;
+        if (link) {
+            data->act_ref_valid = false;
+        }
+    }
+}
+
+/**
+ * @brief FIFO durumuna gore WATERMARK ve DATA_READY bitlerini gunceller.
+ */
+private void emul_update_status( struct adxl345_emul_data *data )
+{
+    uint8_t ctl = data->regs[ADXL345_FIFO_CTL];
+    uint8_t *src = &data->regs[ADXL345_INT_SOURCE];
+
+    WRITE_BIT(*src, 7, data->fifo_count > 0);
+    WRITE_BIT(*src, 1, (ctl & ADXL_FIFO_CTL_MODE_MASK) != ADXL_FIFO_CTL_MODE_BYPASS &&
+                       data->fifo_count >= (ctl & ADXL_FIFO_CTL_SAMPLES_MASK));
+
+    data->regs[ADXL345_FIFO_STATUS] = data->fifo_count |
+                                      (data->triggered ? ADXL_FIFO_STATUS_TRIGGER : 0);
+}
+
+/**
+ * @brief Etkin ve haritalanmis interrupt kaynaklarina gore INT pinlerini surer.
+ *
+ * INT_MAP biti 1 olan kaynaklar INT2'yi, 0 olanlar INT1'i surer. Pin geri
+ * cagirmalari SPI okumasi yapabildigi icin spinlock disinda cagrilir.
+ */
+private void emul_drive_pins( struct adxl345_emul_data *data )
+{
+    if (!data->primary) {
+        return;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&data->lock);
+    uint8_t active = data->regs[ADXL345_INT_SOURCE] & data->regs[ADXL345_INT_ENABLE];
+    uint8_t map = data->regs[ADXL345_INT_MAP];
+    k_spin_unlock(&data->lock, key);
+
+#if DT_NODE_EXISTS(DT_ALIAS(adxl_int1))
+    gpio_emul_input_set(emul_int1.port, emul_int1.pin, (active & ~map) ? 1 : 0);
+#endif
+#if DT_NODE_EXISTS(DT_ALIAS(adxl_select))
+    gpio_emul_input_set(emul_int2.port, emul_int2.pin, (active & map) ? 1 : 0);
+#endif
+    ARG_UNUSED(active);
+    ARG_UNUSED(map);
+}
+
+/**
+ * @brief Gecen sureye gore ODR hizinda yeni ornekler uretir.
+ */
+private void emul_timer_handler( struct k_timer *timer )
+{
+    struct adxl345_emul_data *data = CONTAINER_OF(timer, struct adxl345_emul_data, timer);
+    k_spinlock_key_t key = k_spin_lock(&data->lock);
+    uint8_t power = data->regs[ADXL345_POWER_CTL];
+
+    /* Zamana bagli iz: konum ODR'den bagimsiz ilerler, ornekler arasinda deger tutulur */
+    if (data->trace_rate_mhz) {
+        data->trace_acc += (uint64_t)data->trace_rate_mhz * ADXL_EMUL_TICK_MS;
+        while (data->trace_acc >= 1000000U) {
+            data->trace_pos = (data->trace_pos + 1) % data->trace_len;
+            data->trace_acc -= 1000000U;
+        }
+    }
+
+    if (power & ADXL_POWER_CTL_MEASURE) {
+        bool asleep = (power & ADXL_POWER_CTL_SLEEP) ||
+                      ((power & ADXL_POWER_CTL_AUTO_SLEEP) && data->inactive);
+        uint32_t odr_mhz = asleep ? emul_wakeup_mhz[power & 0x03]
+                                  : adxl345_odr_mhz(data->regs[ADXL345_BW_RATE]);
+
+        data->sample_acc += (uint64_t)odr_mhz * ADXL_EMUL_TICK_MS;
+        while (data->sample_acc >= 1000000U) {
+            const struct adxl345_sample *mg = &data->trace[data->trace_pos];
+            struct adxl345_sample raw = {
+                .x = emul_mg_to_raw(data, mg->x),
+                .y = emul_mg_to_raw(data, mg->y),
+                .z = emul_mg_to_raw(data, mg->z),
+            };
+
+            if (!data->trace_rate_mhz) {
+                data->trace_pos = (data->trace_pos + 1) % data->trace_len;
+            }
+            data->sample_acc -= 1000000U;
+            emul_fifo_push(data, &raw);
+            emul_detect_motion(data, mg, odr_mhz);
+        }
+        emul_update_status(data);
+    }
+
+    k_spin_unlock(&data->lock, key);
+    emul_drive_pins(data);
+}
+
+/**
+ * @brief Yazilan register'in yan etkilerini uygular.
+ */
+private void emul_write_reg( struct adxl345_emul_data *data , uint8_t reg , uint8_t value )
+{
+    switch (reg) {
+    case ADXL345_DEVID_REG:
+    case ADXL345_INT_SOURCE:
+    case ADXL345_FIFO_STATUS:
+        return;
+    case ADXL345_FIFO_CTL:
+        if ((value & ADXL_FIFO_CTL_MODE_MASK) == ADXL_FIFO_CTL_MODE_BYPASS ||
+            (value & ADXL_FIFO_CTL_MODE_MASK) != (data->regs[reg] & ADXL_FIFO_CTL_MODE_MASK)) {
+            data->fifo_head = 0;
+            data->fifo_count = 0;
+            data->triggered = false;
+        }
+        break;
+    case ADXL345_POWER_CTL:
+        if (!(data->regs[reg] & ADXL_POWER_CTL_MEASURE) && (value & ADXL_POWER_CTL_MEASURE)) {
+            data->sample_acc = 0;
+            data->below_inact = 0;
+            data->inactive = false;
+            data->act_ref_valid = false;
+            data->inact_ref_valid = false;
+        }
+        break;
+    case ADXL345_ACT_INACT_CTL:
+        data->act_ref_valid = false;
+        data->inact_ref_valid = false;
+        break;
+    default:
+        break;
+    }
+
+    if (reg >= ADXL345_DATAX0 && reg < ADXL345_FIFO_CTL) {
+        return;
+    }
+    data->regs[reg] = value;
+}
+
+/**
+ * @brief Bir register erisimini register dosyasi uzerinde uygular.
+ *
+ * INT_SOURCE okunursa kilitlenen olay bitleri temizlenir; DATAX0'i iceren
+ * okuma FIFO'dan bir ornek ceker. Hat suresi cagiran tarafindan modellenir.
+ *
+ * @param read      Okuma ise true.
+ * @param reg       Ilk register adresi.
+ * @param auto_inc  Her byte'ta adres artirilir (SPI'da MB biti, I2C'de her zaman).
+ * @param buf       Okumada doldurulan, yazmada yazilan byte'lar.
+ * @param len       Byte sayisi.
+ */
+private void emul_access( struct adxl345_emul_data *data , bool read , uint8_t reg , bool auto_inc ,
+                          uint8_t *buf , size_t len )
+{
+    k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+    if (read && reg <= ADXL345_DATAX0 && reg + len > ADXL345_DATAX0) {
+        emul_fifo_pop(data);
+    }
+
+    for (size_t i = 0; i < len; i++) {
+        if (reg > ADXL345_REG_MAX) {
+            break;
+        }
+        if (read) {
+            buf[i] = data->regs[reg];
+            if (reg == ADXL345_INT_SOURCE) {
+                data->regs[reg] &= ~EMUL_INT_LATCHED;
+            }
+        } else {
+            emul_write_reg(data, reg, buf[i]);
+        }
+        if (auto_inc) {
+            reg++;
+        }
+    }
+    emul_update_status(data);
+
+    k_spin_unlock(&data->lock, key);
+
+    emul_drive_pins(data);
+}
+
+/**
+ * @brief Hat suresini modeller: gercek hattaki gibi aktarim boyunca hat mesgul kalir.
+ */
+private void emul_bus_delay( enum adxl345_bus_type type , bool read , size_t len , uint32_t freq_hz )
+{
+    if (freq_hz) {
+        k_busy_wait((uint32_t)((adxl345_bus_wire_bits(type, read, len) * 1000000ULL) / freq_hz));
+    }
+}
+
+#if ADXL345_BUS_SPI
+/**
+ * @brief SPI emulator I/O fonksiyonu.
+ *
+ * Ilk byte komut byte'idir (bit7: okuma, bit6: multi-byte, bit5..0: adres).
+ * Sonraki byte'lar okuma veya yazma verisidir. Parcali buffer setleri tek bir
+ * byte akisi olarak islenir. Hat zamanlamasinin olculebilmesi icin aktarim
+ * suresi SPI frekansina gore bekleyerek modellenir.
+ */
+private int adxl345_emul_io( const struct emul *target , const struct spi_config *config ,
+                             const struct spi_buf_set *tx_bufs , const struct spi_buf_set *rx_bufs )
+{
+    struct adxl345_emul_data *data = target->data;
+    uint8_t tx[ADXL_EMUL_XFER_MAX] = {0};
+    uint8_t rx[ADXL_EMUL_XFER_MAX] = {0};
+    size_t tx_len = 0;
+    size_t rx_len = 0;
+
+    for (size_t i = 0; tx_bufs && i < tx_bufs->count; i++) {
+        const struct spi_buf *buf = &tx_bufs->buffers[i];
+
+        if (tx_len + buf->len > sizeof(tx)) {
+            return -EINVAL;
+        }
+        if (buf->buf) {
+            memcpy(&tx[tx_len], buf->buf, buf->len);
+        }
+        tx_len += buf->len;
+    }
+    for (size_t i = 0; rx_bufs && i < rx_bufs->count; i++) {
+        rx_len += rx_bufs->buffers[i].len;
+    }
+
+    size_t len = MAX(tx_len, rx_len);
+
+    if (len < 1 || len > sizeof(rx)) {
+        return -EINVAL;
+    }
+
+    bool read = tx[0] & ADXL_SPI_READ;
+    bool multi = tx[0] & ADXL_SPI_MB;
+    uint8_t reg = tx[0] & 0x3F;
+
+    emul_bus_delay(ADXL345_BUS_TYPE_SPI, read, len - 1, config->frequency);
+    emul_access(data, read, reg, multi, read ? &rx[1] : &tx[1], len - 1);
+
+    size_t pos = 0;
+
+    for (size_t i = 0; rx_bufs && i < rx_bufs->count; i++) {
+        const struct spi_buf *buf = &rx_bufs->buffers[i];
+
+        if (buf->buf) {
+            memcpy(buf->buf, &rx[pos], buf->len);
+        }
+        pos += buf->len;
+    }
+    return 0;
+}
+
+static struct spi_emul_api adxl345_emul_api = {
+    .io = adxl345_emul_io,
+};
+#endif
+
+#if ADXL345_BUS_I2C
+/**
+ * @brief I2C emulator transfer fonksiyonu.
+ *
+ * Ilk mesaj register adresi ile baslayan bir yazmadir. Ardindan okuma mesaji
+ * geliyorsa (RESTART) o adresten okunur; yoksa ilk mesajin kalan byte'lari
+ * ve varsa ikinci yazma mesaji register'lara yazilir. ADXL345 I2C'de adresi
+ * her byte'ta kendisi artirir.
+ */
+private int adxl345_emul_i2c_transfer( const struct emul *target , struct i2c_msg *msgs , int num_msgs , int addr )
+{
+    struct adxl345_emul_data *data = target->data;
+
+    ARG_UNUSED(addr);
+
+    if (num_msgs < 1 || num_msgs > 2 || msgs[0].len < 1 ||
+        (msgs[0].flags & I2C_MSG_RW_MASK) != I2C_MSG_WRITE) {
+        return -EIO;
+    }
+
+    uint8_t reg = msgs[0].buf[0];
+
+    if (num_msgs == 2 && (msgs[1].flags & I2C_MSG_RW_MASK) == I2C_MSG_READ) {
+        emul_bus_delay(ADXL345_BUS_TYPE_I2C, true, msgs[1].len, ADXL345_BUS_FREQ_HZ);
+        emul_access(data, true, reg, true, msgs[1].buf, msgs[1].len);
+        return 0;
+    }
+
+    uint8_t *payload = &msgs[0].buf[1];
+    size_t len = msgs[0].len - 1;
+
+    if (num_msgs == 2) {
+        if (len) {
+            return -EIO;
+        }
+        payload = msgs[1].buf;
+        len = msgs[1].len;
+    }
+    emul_bus_delay(ADXL345_BUS_TYPE_I2C, false, len, ADXL345_BUS_FREQ_HZ);
+    emul_access(data, false, reg, true, payload, len);
+    return 0;
+}
+
+static struct i2c_emul_api adxl345_emul_api = {
+    .transfer = adxl345_emul_i2c_transfer,
+};
+#endif
+
+public void adxl345_emul_set_trace(const struct adxl345_sample *samples, uint32_t count)
+{
+    struct adxl345_emul_data *data = emul_primary;
+    k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+    if (samples && count) {
+        data->trace = samples;
+        data->trace_len = count;
+    } else {
+        data->trace = emul_default_trace;
+        data->trace_len = ARRAY_SIZE(emul_default_trace);
+    }
+    data->trace_pos = 0;
+    data->trace_acc = 0;
+
+    k_spin_unlock(&data->lock, key);
+}
+
+public void adxl345_emul_set_trace_rate(uint32_t rate_mhz)
+{
+    struct adxl345_emul_data *data = emul_primary;
+    k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+    data->trace_rate_mhz = rate_mhz;
+    data->trace_acc = 0;
+    k_spin_unlock(&data->lock, key);
+}
+
+private int adxl345_emul_init( const struct emul *target , const struct device *parent )
+{
+    struct adxl345_emul_data *data = target->data;
+
+    ARG_UNUSED(parent);
+
+    data->regs[ADXL345_DEVID_REG] = ADXL345_ID_DEVID;
+    data->regs[ADXL345_BW_RATE] = ADXL_BW_RATE_100HZ;
+    data->regs[ADXL345_INT_SOURCE] = ADXL_INT_SOURCE_DATA_READY;
+    data->trace = emul_default_trace;
+    data->trace_len = ARRAY_SIZE(emul_default_trace);
+    data->primary = (target->dev == DEVICE_DT_GET(ADXL345_NODE));
+    if (data->primary) {
+        emul_primary = data;
+    }
+
+    k_timer_init(&data->timer, emul_timer_handler, NULL);
+    k_timer_start(&data->timer, K_MSEC(ADXL_EMUL_TICK_MS), K_MSEC(ADXL_EMUL_TICK_MS));
+
+    LOG_INFO("ADXL345 emulatoru hazir");
+    return 0;
+}
+
+/*
+ * Emulator kaydi ayni dugum icin bir cihaz nesnesi bekler. Uygulama sensore
+ * Zephyr sensor API'si yerine dogrudan SPI/I2C ile eristigi icin bos bir cihaz tanimlanir.
+ * Hattaki her `adi,adxl345` dugumu ayri bir emulator alir; ek dugumler (ornegin
+ * `adxlaux`) hat zamanlayicisinin cihazlar arasi davranisini olcmek icindir.
+ */
+#define ADXL345_EMUL_DEFINE(inst)                                                                   \
+    static struct adxl345_emul_data emul_data_##inst;                                               \
+    DEVICE_DT_INST_DEFINE(inst, NULL, NULL, NULL, NULL, POST_KERNEL, CONFIG_APPLICATION_INIT_PRIORITY, NULL); \
+    EMUL_DT_INST_DEFINE(inst, adxl345_emul_init, &emul_data_##inst, NULL, &adxl345_emul_api, NULL);
+
+DT_INST_FOREACH_STATUS_OKAY(ADXL345_EMUL_DEFINE)
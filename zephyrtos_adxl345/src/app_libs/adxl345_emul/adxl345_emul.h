@@ -0,0 +1,47 @@
+/**
+ * @file adxl345_emul.h
+ * @brief native_sim icin ADXL345 SPI/I2C emulatoru
+ *
+ * Emulator register dosyasini, 32 orneklik FIFO'yu ve aktivite/inaktivite,
+ * watermark ve data-ready interrupt'larini modeller. Ivme verisi mg cinsinden
+ * verilen bir iz (trace) dizisinden, ayarli ODR hizinda dongusel olarak okunur.
+ */
+#ifndef ADXL345_EMUL_H
+#define ADXL345_EMUL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "adxl345.h"
+
+/**
+ * @brief Emulatorun ornek uretecegi ivme izini ayarlar.
+ *
+ * Ornekler mg cinsindendir; emulator bunlari gecerli DATA_FORMAT ayarina gore
+ * LSB'ye cevirir ve range disina tasan degerleri kirpar. NULL verilirse
+ * sabit 1 g (Z ekseni) kullanilir.
+ *
+ * @param samples   mg cinsinden ornek dizisi.
+ * @param count     Dizideki ornek sayisi.
+ */
+public void adxl345_emul_set_trace(const struct adxl345_sample *samples, uint32_t count);
+
+/**
+ * @brief Izin zaman cozunurlugunu ayarlar.
+ *
+ * 0 (varsayilan): her uretilen ornek izin bir sonraki elemanidir; iz ODR
+ * hizinda oynatilir. Sifirdan farkliysa iz bu hizda kaydedilmis kabul edilir
+ * ve ODR'den (uyku modundaki dusuk hiz dahil) bagimsiz olarak gercek zamanda
+ * ilerler; ornekler arasinda son deger tutulur. Farkli ayarlarin ayni hareket
+ * uzerinde karsilastirilmasi icin kullanilir.
+ *
+ * @param rate_mhz  Izin ornekleme hizi (mHz) veya 0.
+ */
+public void adxl345_emul_set_trace_rate(uint32_t rate_mhz);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ADXL345_EMUL_H
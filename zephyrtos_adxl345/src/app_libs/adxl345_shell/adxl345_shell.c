@@ -0,0 +1,563 @@
+/**
+ * @file adxl345_shell.c
+ * @brief ADXL345 icin calisma aninda ayar ve izleme shell komutlari
+ *
+ * `adxl` kok komutu altinda register okuma/yazma, BW_RATE, range, FULL_RES, esik ve
+ * TIME_INACT ayarlari, ornek akisi, hat (SPI/I2C) performans sayaclari ve hat
+ * zamanlayicisi istatistikleri sunulur.
+ * Diger moduller kendi alt komutlarini SHELL_SUBCMD_ADD((adxl), ...) ile ekler.
+ */
+#include "utils.h"
+#include "adxl345.h"
+#include "spi_bus.h"
+#include "autorange.h"
+#include <zephyr/shell/shell.h>
+#include <string.h>
+
+/**
+ * @brief `adxl stream` icin izin verilen en yuksek yazdirma hizi (Hz).
+ * Shell backend'ini (native_sim pty veya UART) bogmamak icin sinirlandirilir.
+ */
+#define ADXL_SHELL_STREAM_MAX_HZ     50
+
+/** @brief Tek komutta okunabilecek en fazla register sayisi */
+#define ADXL_SHELL_READ_MAX          16
+
+/**
+ * @brief Hattaki ikinci cihaz (yalnizca emulatorlu overlay'lerde).
+ * Varsa ucuncu yuk thread'i ona okuma yapar; boylece cihaz gecisleri ve batching olculur.
+ */
+#define ADXL_SHELL_AUX_NODE          DT_NODELABEL(adxlaux)
+#define ADXL_SHELL_BUS_AUX           DT_NODE_HAS_STATUS(ADXL_SHELL_AUX_NODE, okay)
+
+/** @brief `adxl bus load` yuk thread'leri; event loop'tan dusuk oncelikli */
+#if ADXL_SHELL_BUS_AUX
+#define ADXL_SHELL_BUS_LOAD_THREADS  3
+#else
+#define ADXL_SHELL_BUS_LOAD_THREADS  2
+#endif
+#define ADXL_SHELL_BUS_LOAD_STACK    768
+#define ADXL_SHELL_BUS_LOAD_PRIORITY 6
+
+/**
+ * @brief Yuk thread'inin dokum aldigi ilk register (THRESH_TAP); dokum INT_MAP'te biter.
+ * INT_SOURCE ve DATAX0 okunursa interrupt bitleri ve FIFO girisleri tuketilir, bu yuzden disarida kalir.
+ */
+#define ADXL_SHELL_BUS_DUMP_FIRST    0x1D
+
+/** @brief `adxl bus xfer` modelinde tasimalarin azami saatleri (ADXL345 datasheet) */
+#define ADXL_SHELL_SPI_MAX_HZ        5000000
+#define ADXL_SHELL_I2C_MAX_HZ        400000
+
+/** @brief `adxl bus xfer` icin en fazla okuma sayisi */
+#define ADXL_SHELL_XFER_MAX          10000
+
+static K_THREAD_STACK_ARRAY_DEFINE(bus_load_stacks, ADXL_SHELL_BUS_LOAD_THREADS, ADXL_SHELL_BUS_LOAD_STACK);
+static struct k_thread bus_load_threads[ADXL_SHELL_BUS_LOAD_THREADS];
+static volatile bool bus_load_running;
+
+#if ADXL_SHELL_BUS_AUX
+static const struct adxl345_bus aux_bus = ADXL345_BUS_DT_SPEC_NODE(ADXL_SHELL_AUX_NODE);
+#endif
+
+
+/**
+ * @brief Komut argumanini 0..max araliginda bir sayiya cevirir.
+ *
+ * Onek ile hex (0x..) veya ondalik deger kabul edilir.
+ *
+ * @param[in]  sh       Hata mesajinin yazilacagi shell.
+ * @param[in]  str      Cevrilecek arguman.
+ * @param[in]  max      Izin verilen en buyuk deger.
+ * @param[out] value    Cevrilen deger.
+ * @return Basariliysa 0, aksi halde -EINVAL.
+ */
+private int parse_arg( const struct shell *sh , const char *str , unsigned long max , unsigned long *value )
+{
+    int err = 0;
+
+    *value = shell_strtoul(str, 0, &err);
+    if (err || *value > max) {
+        shell_error(sh, "Gecersiz deger: %s (0..%lu)", str, max);
+        return -EINVAL;
+    }
+    return 0;
+}
+
+private int cmd_reg_read(const struct shell *sh, size_t argc, char **argv)
+{
+    unsigned long reg;
+    unsigned long count = 1;
+    uint8_t data[ADXL_SHELL_READ_MAX];
+
+    if (parse_arg(sh, argv[1], ADXL345_REG_MAX, &reg)) {
+        return -EINVAL;
+    }
+    if (argc > 2 && parse_arg(sh, argv[2], ADXL_SHELL_READ_MAX, &count)) {
+        return -EINVAL;
+    }
+    if (count == 0 || reg + count - 1 > ADXL345_REG_MAX) {
+        shell_error(sh, "Register araligi gecersiz");
+        return -EINVAL;
+    }
+
+    int err = adxl345_read_reg(adxl345_get_bus(), reg, data, count);
+    if (err) {
+        shell_error(sh, "Okuma hatasi: %d", err);
+        return err;
+    }
+
+    for (unsigned long i = 0; i < count; i++) {
+        shell_print(sh, "0x%02lX: 0x%02X", reg + i, data[i]);
+    }
+    return 0;
+}
+
+private int cmd_reg_write(const struct shell *sh, size_t argc, char **argv)
+{
+    unsigned long reg;
+    unsigned long value;
+
+    ARG_UNUSED(argc);
+    if (parse_arg(sh, argv[1], ADXL345_REG_MAX, &reg) ||
+        parse_arg(sh, argv[2], UINT8_MAX, &value)) {
+        return -EINVAL;
+    }
+
+    /* Onbellekteki ayarlar (adxl config, blok DATA_FORMAT etiketi) guncel kalir */
+    int err = adxl345_set_reg(reg, value);
+    if (err) {
+        shell_error(sh, "Yazma hatasi: %d", err);
+        return err;
+    }
+    shell_print(sh, "0x%02lX <- 0x%02lX", reg, value);
+    return 0;
+}
+
+private int cmd_rate(const struct shell *sh, size_t argc, char **argv)
+{
+    unsigned long rate;
+    uint8_t bw_rate;
+
+    if (parse_arg(sh, argv[1], ADXL_BW_RATE_3200HZ, &rate)) {
+        return -EINVAL;
+    }
+    bw_rate = rate;
+    if (argc > 2) {
+        if (strcmp(argv[2], "lp") != 0) {
+            shell_error(sh, "Bilinmeyen secenek: %s", argv[2]);
+            return -EINVAL;
+        }
+        bw_rate |= ADXL_BW_RATE_LOW_POWER;
+    }
+
+    int err = adxl345_set_bw_rate(bw_rate);
+    if (err) {
+        shell_error(sh, "BW_RATE ayarlanamadi: %d", err);
+        return err;
+    }
+    shell_print(sh, "BW_RATE = 0x%02X", bw_rate);
+    return 0;
+}
+
+private int cmd_range(const struct shell *sh, size_t argc, char **argv)
+{
+    unsigned long g;
+    uint8_t range;
+
+    ARG_UNUSED(argc);
+    if (parse_arg(sh, argv[1], 16, &g)) {
+        return -EINVAL;
+    }
+
+    switch (g) {
+    case 2:  range = ADXL_DATA_FORMAT_RANGE_2G;  break;
+    case 4:  range = ADXL_DATA_FORMAT_RANGE_4G;  break;
+    case 8:  range = ADXL_DATA_FORMAT_RANGE_8G;  break;
+    case 16: range = ADXL_DATA_FORMAT_RANGE_16G; break;
+    default:
+        shell_error(sh, "Range 2, 4, 8 veya 16 olmali");
+        return -EINVAL;
+    }
+
+    /* Once kapatilir; aksi halde autorange listener'i secimi hemen ezebilir */
+    if (autorange_is_enabled()) {
+        autorange_enable(false);
+        shell_print(sh, "Autorange kapatildi (adxl autorange on)");
+    }
+    int err = adxl345_set_range(range);
+    if (err) {
+        shell_error(sh, "Range ayarlanamadi: %d", err);
+        return err;
+    }
+    shell_print(sh, "Range = +-%lu g", g);
+    return 0;
+}
+
+private int cmd_fullres(const struct shell *sh, size_t argc, char **argv)
+{
+    bool enable;
+
+    ARG_UNUSED(argc);
+    if (strcmp(argv[1], "on") == 0) {
+        enable = true;
+    } else if (strcmp(argv[1], "off") == 0) {
+        enable = false;
+    } else {
+        shell_error(sh, "on veya off bekleniyor");
+        return -EINVAL;
+    }
+
+    int err = adxl345_set_full_res(enable);
+    if (err) {
+        shell_error(sh, "FULL_RES ayarlanamadi: %d", err);
+        return err;
+    }
+    shell_print(sh, "FULL_RES = %s", enable ? "acik (3.9 mg/LSB)" : "kapali (10 bit)");
+    return 0;
+}
+
+private int cmd_thresh(const struct shell *sh, size_t argc, char **argv)
+{
+    unsigned long mg;
+    int err;
+
+    ARG_UNUSED(argc);
+    if (parse_arg(sh, argv[2], 15937, &mg)) {
+        return -EINVAL;
+    }
+
+    /* 62.5 mg/LSB: mg * 2 / 125 */
+    uint8_t raw = (mg * 2 + 62) / 125;
+
+    if (strcmp(argv[1], "act") == 0) {
+        err = adxl345_set_thresh_act(raw);
+    } else if (strcmp(argv[1], "inact") == 0) {
+        err = adxl345_set_thresh_inact(raw);
+    } else {
+        shell_error(sh, "act veya inact bekleniyor");
+        return -EINVAL;
+    }
+
+    if (err) {
+        shell_error(sh, "Esik ayarlanamadi: %d", err);
+        return err;
+    }
+    shell_print(sh, "%s esigi = 0x%02X (%u mg)", argv[1], raw, (raw * 125U) / 2U);
+    return 0;
+}
+
+private int cmd_inact_time(const struct shell *sh, size_t argc, char **argv)
+{
+    unsigned long seconds;
+
+    ARG_UNUSED(argc);
+    if (parse_arg(sh, argv[1], ADXL_TIME_INACT_MAX, &seconds)) {
+        return -EINVAL;
+    }
+
+    int err = adxl345_set_time_inact(seconds);
+    if (err) {
+        shell_error(sh, "TIME_INACT ayarlanamadi: %d", err);
+        return err;
+    }
+    shell_print(sh, "TIME_INACT = %lu sn", seconds);
+    return 0;
+}
+
+private int cmd_config(const struct shell *sh, size_t argc, char **argv)
+{
+    struct adxl345_config config;
+
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+    adxl345_get_config(&config);
+
+    shell_print(sh, "BW_RATE      : 0x%02X", config.bw_rate);
+    shell_print(sh, "DATA_FORMAT  : 0x%02X (+-%d g, %s)", config.data_format,
+                2 << (config.data_format & ADXL_DATA_FORMAT_RANGE_MASK),
+                (config.data_format & ADXL_DATA_FORMAT_FULL_RES) ? "FULL_RES" : "10 bit");
+    shell_print(sh, "THRESH_ACT   : 0x%02X (%u mg)", config.thresh_act, (config.thresh_act * 125U) / 2U);
+    shell_print(sh, "THRESH_INACT : 0x%02X (%u mg)", config.thresh_inact, (config.thresh_inact * 125U) / 2U);
+    shell_print(sh, "TIME_INACT   : %u sn", config.time_inact);
+    return 0;
+}
+
+private int cmd_stream(const struct shell *sh, size_t argc, char **argv)
+{
+    unsigned long hz;
+    unsigned long count;
+    struct adxl345_sample sample;
+
+    ARG_UNUSED(argc);
+    if (parse_arg(sh, argv[1], UINT16_MAX, &hz) ||
+        parse_arg(sh, argv[2], UINT16_MAX, &count)) {
+        return -EINVAL;
+    }
+    if (hz == 0) {
+        return -EINVAL;
+    }
+    if (hz > ADXL_SHELL_STREAM_MAX_HZ) {
+        shell_warn(sh, "Hiz %d Hz ile sinirlandi", ADXL_SHELL_STREAM_MAX_HZ);
+        hz = ADXL_SHELL_STREAM_MAX_HZ;
+    }
+
+    int64_t next = k_uptime_get();
+
+    for (unsigned long i = 0; i < count; i++) {
+        int err = adxl345_read_sample(&sample);
+        if (err) {
+            shell_error(sh, "Ornek okunamadi: %d", err);
+            return err;
+        }
+        shell_print(sh, "%6d %6d %6d mg",
+                    adxl345_raw_to_mg(sample.x),
+                    adxl345_raw_to_mg(sample.y),
+                    adxl345_raw_to_mg(sample.z));
+
+        next += 1000 / hz;
+        k_sleep(K_TIMEOUT_ABS_MS(next));
+    }
+    return 0;
+}
+
+private int cmd_stats(const struct shell *sh, size_t argc, char **argv)
+{
+    struct adxl345_stats stats;
+
+    if (argc > 1) {
+        if (strcmp(argv[1], "reset") != 0) {
+            shell_error(sh, "Bilinmeyen secenek: %s", argv[1]);
+            return -EINVAL;
+        }
+        adxl345_reset_stats();
+        shell_print(sh, "Sayaclar sifirlandi");
+        return 0;
+    }
+
+    adxl345_get_stats(&stats);
+    uint32_t count = stats.read_count + stats.write_count;
+    uint64_t avg_ns = count ? k_cyc_to_ns_floor64(stats.total_cycles) / count : 0;
+
+    shell_print(sh, "okuma        : %u", stats.read_count);
+    shell_print(sh, "yazma        : %u", stats.write_count);
+    shell_print(sh, "hata         : %u", stats.error_count);
+    shell_print(sh, "veri byte    : %u", stats.bytes);
+    shell_print(sh, "hat biti     : %llu (%s)", stats.wire_bits, ADXL345_BUS_TYPE == ADXL345_BUS_TYPE_I2C ? "i2c" : "spi");
+    shell_print(sh, "ort. sure    : %llu ns", avg_ns);
+    shell_print(sh, "en uzun sure : %llu ns", k_cyc_to_ns_floor64(stats.max_cycles));
+    return 0;
+}
+
+
+/**
+ * @brief `adxl bus load` yuk thread'i.
+ *
+ * Birinci thread BULK sinifinda uzun register dokumu ve ayar yazimi
+ * (mevcut degerle) yapar; ikinci thread NORMAL sinifta tekil register okur.
+ * Ucuncu thread (varsa) ayni okumayi hattaki ikinci cihaza yapar; surucu
+ * sayaclarina girmemesi icin dogrudan hat katmanini kullanir. Hepsi hatti
+ * surekli mesgul tutarak FIFO bosaltma ile yarisir.
+ */
+private void bus_load_thread(void *vp1, void *vp2, void *vp3)
+{
+    intptr_t id = (intptr_t)vp1;
+    const struct adxl345_bus *bus = adxl345_get_bus();
+    uint8_t dump[ADXL345_INT_MAP - ADXL_SHELL_BUS_DUMP_FIRST + 1];
+    struct adxl345_config config;
+
+    ARG_UNUSED(vp2);
+    ARG_UNUSED(vp3);
+
+    while (bus_load_running) {
+        if (id == 0) {
+            spi_bus_acquire(bus, SPI_BUS_CLASS_BULK, 0);
+            adxl345_read_reg(bus, ADXL_SHELL_BUS_DUMP_FIRST, dump, sizeof(dump));
+            spi_bus_release();
+
+            adxl345_get_config(&config);
+            adxl345_set_thresh_act(config.thresh_act);
+        } else if (id == 1) {
+            adxl345_read_reg(bus, ADXL345_BW_RATE, dump, 1);
+        } else {
+#if ADXL_SHELL_BUS_AUX
+            spi_bus_acquire(&aux_bus, SPI_BUS_CLASS_NORMAL, 0);
+            adxl345_bus_read(&aux_bus, ADXL345_BW_RATE, dump, 1);
+            spi_bus_release();
+#endif
+        }
+        k_yield();
+    }
+}
+
+private void print_bus_stats( const struct shell *sh )
+{
+    static const char *const names[SPI_BUS_CLASS_COUNT] = { "RT", "NORMAL", "BULK" };
+    struct spi_bus_class_stats stats[SPI_BUS_CLASS_COUNT];
+
+    spi_bus_get_stats(stats);
+    shell_print(sh, "%-7s %8s %8s %7s %7s %7s %7s %11s %11s %9s", "sinif", "oturum", "bekleme", "batch",
+                "cs gec.", "devir", "kacan", "max bek.us", "max top.us", "ort.us");
+    for (int c = 0; c < SPI_BUS_CLASS_COUNT; c++) {
+        uint64_t avg = stats[c].sessions ? stats[c].total_cycles / stats[c].sessions : 0;
+
+        shell_print(sh, "%-7s %8u %8u %7u %7u %7u %7u %11u %11u %9u", names[c], stats[c].sessions,
+                    stats[c].contended, stats[c].batched, stats[c].switches, stats[c].boosted,
+                    stats[c].deadline_miss,
+                    k_cyc_to_us_floor32(stats[c].max_wait_cycles),
+                    k_cyc_to_us_floor32(stats[c].max_total_cycles),
+                    k_cyc_to_us_floor32((uint32_t)avg));
+    }
+}
+
+private int cmd_bus_stats(const struct shell *sh, size_t argc, char **argv)
+{
+    if (argc > 1) {
+        if (strcmp(argv[1], "reset") != 0) {
+            shell_error(sh, "Bilinmeyen secenek: %s", argv[1]);
+            return -EINVAL;
+        }
+        spi_bus_reset_stats();
+        return 0;
+    }
+    print_bus_stats(sh);
+    return 0;
+}
+
+/**
+ * @brief Karma yuk altinda FIFO bosaltma gecikmesini olcer.
+ *
+ * Ayni yuk once oncelikli zamanlayici, sonra gelis sirasi (FIFO) ile
+ * uygulanir ve iki tablo raporlanir. RT satiri FIFO bosaltma oturumlaridir;
+ * olcum icin pipeline calisiyor olmalidir (ornegin `adxl pipeline start 13 16`).
+ */
+private int cmd_bus_load(const struct shell *sh, size_t argc, char **argv)
+{
+    static const char *const policy_names[] = { "oncelikli", "gelis sirasi (FIFO)" };
+    unsigned long ms;
+
+    ARG_UNUSED(argc);
+    if (parse_arg(sh, argv[1], 60000, &ms) || ms == 0) {
+        return -EINVAL;
+    }
+
+    for (int policy = SPI_BUS_POLICY_PRIORITY; policy <= SPI_BUS_POLICY_FIFO; policy++) {
+        spi_bus_set_policy(policy);
+        spi_bus_reset_stats();
+        bus_load_running = true;
+
+        for (int i = 0; i < ADXL_SHELL_BUS_LOAD_THREADS; i++) {
+            k_thread_create(&bus_load_threads[i], bus_load_stacks[i], K_THREAD_STACK_SIZEOF(bus_load_stacks[i]),
+                            bus_load_thread, (void *)(intptr_t)i, NULL, NULL,
+                            ADXL_SHELL_BUS_LOAD_PRIORITY, 0, K_NO_WAIT);
+        }
+
+        k_msleep(ms);
+        bus_load_running = false;
+        for (int i = 0; i < ADXL_SHELL_BUS_LOAD_THREADS; i++) {
+            k_thread_join(&bus_load_threads[i], K_FOREVER);
+        }
+
+        shell_print(sh, "\npolitika: %s, %lu ms", policy_names[policy], ms);
+        print_bus_stats(sh);
+    }
+
+    spi_bus_set_policy(SPI_BUS_POLICY_PRIORITY);
+    return 0;
+}
+
+/**
+ * @brief Bir ornek okumasinin hattaki maliyetini bir tasima ve saat icin yazdirir.
+ */
+private void print_xfer_model( const struct shell *sh , enum adxl345_bus_type type , uint32_t freq_hz ,
+                               const char *note )
+{
+    static const char *const names[] = { "spi", "i2c" };
+    uint32_t bits = adxl345_bus_wire_bits(type, true, ADXL345_SAMPLE_SIZE);
+    uint32_t bytes = (type == ADXL345_BUS_TYPE_I2C) ? bits / 9 : bits / 8;
+
+    shell_print(sh, "%s %7u Hz%-9s: %2u byte, %3u bit, %5u us/ornek", names[type], freq_hz, note,
+                bytes, bits, (uint32_t)((bits * 1000000ULL) / freq_hz));
+}
+
+/**
+ * @brief Ornek okumasinin (DATAX0..DATAZ1 burst) hat maliyetini olcer ve SPI/I2C ile karsilastirir.
+ *
+ * Derlenen tasimada `count` ornek okunur ve ornek basina ortalama sure
+ * olculur (hat zamanlayicisi ve surucu yuku dahil). Model satirlari her iki
+ * tasima icin ornek basina hattaki byte/bit sayisini ve saf aktarim suresini
+ * verir; boylece diger tasimanin maliyeti donanim degistirmeden gorulur.
+ */
+private int cmd_bus_xfer(const struct shell *sh, size_t argc, char **argv)
+{
+    unsigned long count = 1000;
+    struct adxl345_sample sample;
+
+    if (argc > 1 && (parse_arg(sh, argv[1], ADXL_SHELL_XFER_MAX, &count) || count == 0)) {
+        return -EINVAL;
+    }
+
+    uint32_t start = k_cycle_get_32();
+
+    for (unsigned long i = 0; i < count; i++) {
+        int err = adxl345_read_sample(&sample);
+        if (err) {
+            shell_error(sh, "Ornek okunamadi: %d", err);
+            return err;
+        }
+    }
+    uint64_t ns = k_cyc_to_ns_floor64(k_cycle_get_32() - start);
+
+    shell_print(sh, "olculen (%s @ %u Hz): %lu ornek, ort. %llu us/ornek",
+                ADXL345_BUS_TYPE == ADXL345_BUS_TYPE_I2C ? "i2c" : "spi", ADXL345_BUS_FREQ_HZ,
+                count, ns / count / 1000);
+    print_xfer_model(sh, ADXL345_BUS_TYPE, ADXL345_BUS_FREQ_HZ, "");
+    print_xfer_model(sh, ADXL345_BUS_TYPE_SPI, ADXL_SHELL_SPI_MAX_HZ, " (azami)");
+    print_xfer_model(sh, ADXL345_BUS_TYPE_I2C, ADXL_SHELL_I2C_MAX_HZ, " (azami)");
+    return 0;
+}
+
+private int cmd_bus_policy(const struct shell *sh, size_t argc, char **argv)
+{
+    ARG_UNUSED(argc);
+
+    if (strcmp(argv[1], "prio") == 0) {
+        spi_bus_set_policy(SPI_BUS_POLICY_PRIORITY);
+    } else if (strcmp(argv[1], "fifo") == 0) {
+        spi_bus_set_policy(SPI_BUS_POLICY_FIFO);
+    } else {
+        shell_error(sh, "Bilinmeyen politika: %s (prio|fifo)", argv[1]);
+        return -EINVAL;
+    }
+    return 0;
+}
+
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_adxl_bus,
+    SHELL_CMD_ARG(stats,  NULL, "Hat oturum istatistikleri: stats [reset]",  cmd_bus_stats,  1, 1),
+    SHELL_CMD_ARG(load,   NULL, "Karma yuk altinda gecikme: load <ms>",      cmd_bus_load,   2, 0),
+    SHELL_CMD_ARG(policy, NULL, "Siralama: policy <prio|fifo>",              cmd_bus_policy, 2, 0),
+    SHELL_CMD_ARG(xfer,   NULL, "Ornek okuma maliyeti, SPI/I2C: xfer [adet]", cmd_bus_xfer,   1, 1),
+    SHELL_SUBCMD_SET_END
+);
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_adxl_reg,
+    SHELL_CMD_ARG(read,  NULL, "Register oku: read <reg> [adet]",   cmd_reg_read,  2, 1),
+    SHELL_CMD_ARG(write, NULL, "Register yaz: write <reg> <deger>", cmd_reg_write, 3, 0),
+    SHELL_SUBCMD_SET_END
+);
+
+SHELL_SUBCMD_SET_CREATE(sub_adxl, (adxl));
+
+SHELL_SUBCMD_ADD((adxl), reg,        &sub_adxl_reg, "Ham register erisimi", NULL, 0, 0);
+SHELL_SUBCMD_ADD((adxl), rate,       NULL, "BW_RATE: rate <0..15> [lp]",         cmd_rate,       2, 1);
+SHELL_SUBCMD_ADD((adxl), range,      NULL, "Olcum araligi: range <2|4|8|16>",    cmd_range,      2, 0);
+SHELL_SUBCMD_ADD((adxl), fullres,    NULL, "Tam cozunurluk: fullres <on|off>",   cmd_fullres,    2, 0);
+SHELL_SUBCMD_ADD((adxl), thresh,     NULL, "Esik: thresh <act|inact> <mg>",      cmd_thresh,     3, 0);
+SHELL_SUBCMD_ADD((adxl), inact_time, NULL, "TIME_INACT: inact_time <sn>",        cmd_inact_time, 2, 0);
+SHELL_SUBCMD_ADD((adxl), config,     NULL, "Gecerli ayarlari goster",            cmd_config,     1, 0);
+SHELL_SUBCMD_ADD((adxl), stream,     NULL, "Ornek akisi: stream <hz> <adet>",    cmd_stream,     3, 0);
+SHELL_SUBCMD_ADD((adxl), stats,      NULL, "Hat sayaclari: stats [reset]",       cmd_stats,      1, 1);
+SHELL_SUBCMD_ADD((adxl), bus,        &sub_adxl_bus, "Hat zamanlayicisi",         NULL,           0, 0);
+
+SHELL_CMD_REGISTER(adxl, &sub_adxl, "ADXL345 ayar ve izleme komutlari", NULL);
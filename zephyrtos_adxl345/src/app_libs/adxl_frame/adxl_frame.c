@@ -0,0 +1,110 @@
+#include "adxl_frame.h"
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+
+LOG_MODULE_REGISTER(adxl_frame, LOG_LEVEL_INF);
+
+
+/**
+ * @brief Bir FIFO blogunu cerceveye kodlar.
+ *
+ * Range ve FULL_RES bayraklari blogun DATA_FORMAT degerinden alinir; ornekler
+ * DATAX0..DATAZ1 sirasiyla little-endian yazilir.
+ *
+ * @param block Kodlanacak blok (listener icinden).
+ * @param buf   Cikis tamponu.
+ * @param size  Tampon boyutu; ADXL_FRAME_MAX_SIZE her blok icin yeterlidir.
+ * @return Basariliysa cerceve boyutu, blok bossa -EINVAL, tampon yetmezse -ENOSPC.
+ */
+public int adxl_frame_encode(const struct adxl345_block *block, uint8_t *buf, size_t size)
+{
+    if (block->count == 0 || block->count > ADXL_FRAME_MAX_SAMPLES) {
+        return -EINVAL;
+    }
+
+    size_t len = ADXL_FRAME_HEADER_SIZE + block->count * ADXL_FRAME_SAMPLE_SIZE;
+    if (size < len) {
+        return -ENOSPC;
+    }
+
+    uint8_t flags = block->data_format & ADXL_FRAME_FLAG_RANGE_MASK;
+    if (block->data_format & ADXL_DATA_FORMAT_FULL_RES) {
+        flags |= ADXL_FRAME_FLAG_FULL_RES;
+    }
+    if (block->overrun) {
+        flags |= ADXL_FRAME_FLAG_OVERRUN;
+    }
+
+    memset(buf, 0, ADXL_FRAME_HEADER_SIZE);
+    buf[ADXL_FRAME_OFF_MAGIC] = ADXL_FRAME_MAGIC;
+    buf[ADXL_FRAME_OFF_VERSION] = ADXL_FRAME_VERSION;
+    buf[ADXL_FRAME_OFF_FLAGS] = flags;
+    buf[ADXL_FRAME_OFF_COUNT] = block->count;
+    sys_put_le32(block->seq, &buf[ADXL_FRAME_OFF_SEQ]);
+    sys_put_le32(block->timestamp, &buf[ADXL_FRAME_OFF_TIMESTAMP]);
+    buf[ADXL_FRAME_OFF_BW_RATE] = block->bw_rate;
+
+    uint8_t *p = &buf[ADXL_FRAME_HEADER_SIZE];
+    for (int i = 0; i < block->count; i++) {
+        sys_put_le16(block->samples[i].x, p);
+        sys_put_le16(block->samples[i].y, p + 2);
+        sys_put_le16(block->samples[i].z, p + 4);
+        p += ADXL_FRAME_SAMPLE_SIZE;
+    }
+    return (int)len;
+}
+
+
+#if defined(CONFIG_SHELL)
+#include <zephyr/shell/shell.h>
+
+static uint8_t last_frame[ADXL_FRAME_MAX_SIZE];
+static int last_frame_len;
+static struct k_spinlock last_frame_lock;
+
+/**
+ * @brief Son blogu cerceveye kodlar; `adxl frame show` icin saklanir.
+ */
+private void frame_block_cb( const struct zbus_channel *chan )
+{
+    const struct adxl345_block *block = zbus_chan_const_msg(chan);
+
+    k_spinlock_key_t key = k_spin_lock(&last_frame_lock);
+    last_frame_len = adxl_frame_encode(block, last_frame, sizeof(last_frame));
+    k_spin_unlock(&last_frame_lock, key);
+}
+
+ZBUS_LISTENER_DEFINE(adxl_frame_listener, frame_block_cb);
+ZBUS_CHAN_ADD_OBS(adxl_block_chan, adxl_frame_listener, 4);
+
+private int cmd_frame_show(const struct shell *sh, size_t argc, char **argv)
+{
+    uint8_t frame[ADXL_FRAME_MAX_SIZE];
+    int len;
+
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    k_spinlock_key_t key = k_spin_lock(&last_frame_lock);
+    len = last_frame_len;
+    if (len > 0) {
+        memcpy(frame, last_frame, len);
+    }
+    k_spin_unlock(&last_frame_lock, key);
+
+    if (len <= 0) {
+        shell_print(sh, "Henuz blok yok (adxl pipeline start)");
+        return 0;
+    }
+    shell_hexdump(sh, frame, len);
+    return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_frame,
+    SHELL_CMD_ARG(show, NULL, "Son FIFO blogunun cercevesi (hex)", cmd_frame_show, 1, 0),
+    SHELL_SUBCMD_SET_END
+);
+
+SHELL_SUBCMD_ADD((adxl), frame, &sub_frame, "Sunucuya gonderilen cerceve formati", NULL, 0, 0);
+#endif
@@ -0,0 +1,25 @@
+/**
+ * @file adxl_frame.h
+ * @brief FIFO bloklarinin kablo formatina (adxl_frame_format.h) kodlanmasi
+ *
+ * Bir `adxl345_block` tek bir cerceveye kodlanir; cerceve BLE, UART veya ag
+ * uzerinden sunucuya gonderilip host/adxl_decoder kutuphanesi ile cozulur.
+ */
+#ifndef ADXL_FRAME_H
+#define ADXL_FRAME_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "adxl_frame_format.h"
+#include "sample_pipeline.h"
+#include "utils.h"
+
+public int adxl_frame_encode(const struct adxl345_block *block, uint8_t *buf, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ADXL_FRAME_H
@@ -0,0 +1,57 @@
+/**
+ * @file adxl_frame_format.h
+ * @brief FIFO bloklari icin kompakt kablo (wire) formati
+ *
+ * Cihaz (adxl_frame.c) ve sunucu tarafi cozucu (host/adxl_decoder) bu dosyayi
+ * ortak kullanir; Zephyr bagimliligi yoktur.
+ *
+ * Cerceve = 16 byte baslik + count * 6 byte veri. Tum alanlar little-endian.
+ *
+ * | Ofset | Boyut | Alan          | Aciklama                                        |
+ * |-------|-------|---------------|-------------------------------------------------|
+ * | 0     | 1     | magic         | ADXL_FRAME_MAGIC (0xA5)                         |
+ * | 1     | 1     | version       | ADXL_FRAME_VERSION                              |
+ * | 2     | 1     | flags         | bit0-1 range, bit2 FULL_RES, bit3 overrun       |
+ * | 3     | 1     | count         | Ornek sayisi (1..ADXL_FRAME_MAX_SAMPLES)        |
+ * | 4     | 4     | seq           | Blok sira numarasi                              |
+ * | 8     | 4     | timestamp_ms  | FIFO'nun bosaltildigi an (cihaz uptime, ms)     |
+ * | 12    | 1     | bw_rate       | BW_RATE register degeri (ODR + LOW_POWER)       |
+ * | 13    | 3     | reserved      | 0                                               |
+ * | 16    | 6*n   | samples       | DATAX0..DATAZ1 sirasiyla int16 X, Y, Z          |
+ *
+ * Ornekler sag hizali (JUSTIFY = 0) ham LSB degerleridir. mg donusumu:
+ * FULL_RES ise LSB = 3.906 mg, degilse LSB = 3.906 mg << range.
+ * overrun biti, bu bloktan once FIFO tasmasi nedeniyle ornek kaybedildigini
+ * gosterir. Baslik boyutu 16 byte'tir; veri 16 byte hizali baslar.
+ */
+#ifndef ADXL_FRAME_FORMAT_H
+#define ADXL_FRAME_FORMAT_H
+
+#include <stdint.h>
+
+#define ADXL_FRAME_MAGIC            0xA5
+#define ADXL_FRAME_VERSION          1
+
+#define ADXL_FRAME_HEADER_SIZE      16
+#define ADXL_FRAME_SAMPLE_SIZE      6
+#define ADXL_FRAME_MAX_SAMPLES      32
+#define ADXL_FRAME_MAX_SIZE         (ADXL_FRAME_HEADER_SIZE + ADXL_FRAME_MAX_SAMPLES * ADXL_FRAME_SAMPLE_SIZE)
+
+/* Baslik alan ofsetleri */
+#define ADXL_FRAME_OFF_MAGIC        0
+#define ADXL_FRAME_OFF_VERSION      1
+#define ADXL_FRAME_OFF_FLAGS        2
+#define ADXL_FRAME_OFF_COUNT        3
+#define ADXL_FRAME_OFF_SEQ          4
+#define ADXL_FRAME_OFF_TIMESTAMP    8
+#define ADXL_FRAME_OFF_BW_RATE      12
+
+/* flags alani */
+#define ADXL_FRAME_FLAG_RANGE_MASK  0x03    /*!< DATA_FORMAT range bitleri (0: ±2 g .. 3: ±16 g) */
+#define ADXL_FRAME_FLAG_FULL_RES    0x04    /*!< Tam cozunurluk: LSB agirligi range'den bagimsiz  */
+#define ADXL_FRAME_FLAG_OVERRUN     0x08    /*!< Bu bloktan once FIFO tasmasi oldu                */
+
+/** @brief 10-bit modda ±2 g icin ve FULL_RES modunda LSB agirligi (ug) */
+#define ADXL_FRAME_SCALE_UG         3906
+
+#endif // ADXL_FRAME_FORMAT_H
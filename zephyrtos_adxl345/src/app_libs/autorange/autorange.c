@@ -0,0 +1,212 @@
+#include "autorange.h"
+#include "sample_pipeline.h"
+#include "utils.h"
+#include <string.h>
+#include <zephyr/kernel.h>
+
+LOG_MODULE_REGISTER(autorange, LOG_LEVEL_INF);
+
+static bool autorange_enabled = AUTORANGE_DEFAULT_ENABLED;
+static uint8_t quiet_blocks;
+
+static struct autorange_stats stats;
+static struct k_spinlock stats_lock;
+
+
+/**
+ * @brief Bir blogun tepe degerine gore hedef range'i belirler.
+ *
+ * Yan etkisi yalnizca `quiet_blocks` sayacidir; register'a yazmaz.
+ *
+ * @param data_format   Blogun yakalandigi DATA_FORMAT.
+ * @param peak          Bloktaki en buyuk mutlak ham deger (LSB).
+ * @param quiet_blocks  Asagi esigin altinda gecen ardisik blok sayaci.
+ * @return Hedef range (ADXL_DATA_FORMAT_RANGE_*).
+ */
+public uint8_t autorange_decide(uint8_t data_format, uint16_t peak, uint8_t *quiet_blocks)
+{
+    uint8_t range = data_format & ADXL_DATA_FORMAT_RANGE_MASK;
+    uint32_t full_scale = adxl345_full_scale_lsb(data_format);
+
+    /* Alt kademenin tam olcegi, mevcut LSB cinsinden her iki modda da yarisidir */
+    uint32_t down_limit = (full_scale / 2) * AUTORANGE_DOWN_PERMILLE;
+
+    if (peak >= full_scale - 1) {
+        *quiet_blocks = 0;
+        return AUTORANGE_MAX_RANGE;
+    }
+    if ((uint32_t)peak * 1000 >= full_scale * AUTORANGE_UP_PERMILLE) {
+        *quiet_blocks = 0;
+        return MIN(range + 1, AUTORANGE_MAX_RANGE);
+    }
+    if (range > AUTORANGE_MIN_RANGE && (uint32_t)peak * 1000 < down_limit) {
+        if (++(*quiet_blocks) >= AUTORANGE_HOLD_BLOCKS) {
+            *quiet_blocks = 0;
+            return range - 1;
+        }
+        return range;
+    }
+
+    *quiet_blocks = 0;
+    return range;
+}
+
+/**
+ * @brief Bloktaki en buyuk mutlak ham degeri bulur.
+ *
+ * Eksenlerin en buyugu ve en kucugu ayri tutulur; ornek basina isaret dallanmasi yoktur.
+ */
+private uint16_t block_peak( const struct adxl345_block *block )
+{
+    int16_t hi = 0;
+    int16_t lo = 0;
+
+    for (int i = 0; i < block->count; i++) {
+        const struct adxl345_sample *s = &block->samples[i];
+
+        hi = MAX(hi, MAX(s->x, MAX(s->y, s->z)));
+        lo = MIN(lo, MIN(s->x, MIN(s->y, s->z)));
+    }
+    return (uint16_t)MAX(hi, -lo);
+}
+
+/**
+ * @brief Her blokta tepe degerini degerlendirir, gerekirse range'i degistirir.
+ *
+ * Listener event loop thread'inde, FIFO bosaltildiktan ve SPI hatti
+ * birakildiktan sonra calisir; range yazimi BULK sinifinda yapilir. Surucu
+ * FULL_RES'te LSB agirligi degismedigi icin FIFO'daki ornekleri korur; yeni
+ * range bir sonraki blogun DATA_FORMAT etiketinde gorulur. 10-bit modda eski
+ * olcekli ornekler atilir ve sonraki blok `overrun` ile gelir.
+ */
+private void autorange_block_cb( const struct zbus_channel *chan )
+{
+    const struct adxl345_block *block = zbus_chan_const_msg(chan);
+    uint8_t range = block->data_format & ADXL_DATA_FORMAT_RANGE_MASK;
+
+    if (block->count == 0) {
+        return;
+    }
+
+    uint16_t peak = block_peak(block);
+    bool saturated = peak >= adxl345_full_scale_lsb(block->data_format) - 1;
+
+    k_spinlock_key_t key = k_spin_lock(&stats_lock);
+    stats.range = range;
+    stats.last_peak_mg = (uint16_t)adxl345_lsb_to_mg(peak, adxl345_lsb_shift(block->data_format));
+    stats.blocks[range]++;
+    if (saturated) {
+        stats.saturated_blocks++;
+    }
+    k_spin_unlock(&stats_lock, key);
+
+    if (!autorange_enabled) {
+        return;
+    }
+
+    uint8_t target = autorange_decide(block->data_format, peak, &quiet_blocks);
+    if (target == range) {
+        return;
+    }
+
+    int err = adxl345_set_range(target);
+
+    key = k_spin_lock(&stats_lock);
+    if (err) {
+        stats.errors++;
+    } else if (target > range) {
+        stats.up_switches++;
+    } else {
+        stats.down_switches++;
+    }
+    k_spin_unlock(&stats_lock, key);
+
+    if (err) {
+        LOG_ERROR("[%s]: Range degistirilemedi! Hata Kodu: %d", __func__, err);
+        return;
+    }
+    LOG_DEBUG("[%s]: Range +-%d g -> +-%d g (tepe %u LSB)", __func__, 2 << range, 2 << target, peak);
+}
+
+ZBUS_LISTENER_DEFINE(autorange_listener, autorange_block_cb);
+ZBUS_CHAN_ADD_OBS(adxl_block_chan, autorange_listener, 0);
+
+
+/**
+ * @brief Autorange'i acar veya kapatir. Kapatildiginda mevcut range korunur.
+ */
+public void autorange_enable(bool enable)
+{
+    quiet_blocks = 0;
+    autorange_enabled = enable;
+}
+
+public bool autorange_is_enabled(void)
+{
+    return autorange_enabled;
+}
+
+public void autorange_get_stats(struct autorange_stats *out)
+{
+    k_spinlock_key_t key = k_spin_lock(&stats_lock);
+    *out = stats;
+    k_spin_unlock(&stats_lock, key);
+}
+
+public void autorange_reset_stats(void)
+{
+    k_spinlock_key_t key = k_spin_lock(&stats_lock);
+    memset(&stats, 0, sizeof(stats));
+    k_spin_unlock(&stats_lock, key);
+}
+
+
+#if defined(CONFIG_SHELL)
+#include <zephyr/shell/shell.h>
+
+private int cmd_autorange_on(const struct shell *sh, size_t argc, char **argv)
+{
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    autorange_enable(true);
+    shell_print(sh, "Autorange acik");
+    return 0;
+}
+
+private int cmd_autorange_off(const struct shell *sh, size_t argc, char **argv)
+{
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    autorange_enable(false);
+    shell_print(sh, "Autorange kapali, range sabit");
+    return 0;
+}
+
+private int cmd_autorange_show(const struct shell *sh, size_t argc, char **argv)
+{
+    struct autorange_stats s;
+
+    autorange_get_stats(&s);
+    if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+        autorange_reset_stats();
+    }
+
+    shell_print(sh, "durum      : %s", autorange_enabled ? "acik" : "kapali");
+    shell_print(sh, "range      : +-%d g, son tepe %u mg", 2 << s.range, s.last_peak_mg);
+    shell_print(sh, "gecis      : yukari %u, asagi %u, hata %u", s.up_switches, s.down_switches, s.errors);
+    shell_print(sh, "doymus blok: %u", s.saturated_blocks);
+    shell_print(sh, "blok       : 2g %u, 4g %u, 8g %u, 16g %u", s.blocks[0], s.blocks[1], s.blocks[2], s.blocks[3]);
+    return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_autorange,
+    SHELL_CMD_ARG(on,   NULL, "Autorange'i ac",                      cmd_autorange_on,   1, 0),
+    SHELL_CMD_ARG(off,  NULL, "Autorange'i kapat (range sabit)",     cmd_autorange_off,  1, 0),
+    SHELL_CMD_ARG(show, NULL, "Durum ve sayaclar: show [reset]",     cmd_autorange_show, 1, 1),
+    SHELL_SUBCMD_SET_END
+);
+
+SHELL_SUBCMD_ADD((adxl), autorange, &sub_autorange, "Otomatik olcum araligi", NULL, 0, 0);
+#endif
@@ -0,0 +1,69 @@
+/**
+ * @file autorange.h
+ * @brief Blok tepe degerine gore otomatik olcum araligi (range) secimi
+ *
+ * Her FIFO blogunda eksenlerin en buyuk mutlak degeri (tepe) blogun kendi
+ * DATA_FORMAT'indaki doyma siniri ile karsilastirilir. Tepe sinira yaklasirsa
+ * range hemen bir kademe, doymussa dogrudan en yuksek kademeye cikarilir.
+ * Bir alt kademenin sinirinin altinda art arda AUTORANGE_HOLD_BLOCKS blok
+ * kalinirsa bir kademe inilir. Esik farki ve blok sayaci histerezis saglar.
+ *
+ * FULL_RES modunda LSB agirligi range'den bagimsizdir; range yalnizca doyma
+ * sinirini belirler. Bloklar yakalandiklari DATA_FORMAT ile etiketlenir
+ * (adxl345_block.data_format), tuketiciler olcegi blok basina bir kez alir.
+ * FULL_RES'te range degisimi LSB agirligini degistirmez; FIFO'daki ornekler
+ * korunur ve yukari gecise yol acan darbe kaybolmaz. 10-bit modda surucu eski
+ * olcekle biriken ornekleri atar ve sonraki blok `overrun` ile gelir; boylece
+ * iki olcek ayni blokta karismaz.
+ */
+#ifndef AUTORANGE_H
+#define AUTORANGE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "adxl345.h"
+
+/** @brief Kullanilacak en dusuk ve en yuksek range */
+#define AUTORANGE_MIN_RANGE         ADXL_DATA_FORMAT_RANGE_2G
+#define AUTORANGE_MAX_RANGE         ADXL_DATA_FORMAT_RANGE_16G
+
+/** @brief Tepe, mevcut tam olcegin bu oranini (binde) asarsa bir kademe yukari */
+#define AUTORANGE_UP_PERMILLE       900
+
+/**
+ * @brief Tepe, bir alt kademenin tam olceginin bu oraninin (binde) altinda kalirsa asagi.
+ * Alt kademede yukari esigin (%90) altinda kalan bir bant birakir; ±2 g'de
+ * durgun 1 g (%50) inisi engellemez.
+ */
+#define AUTORANGE_DOWN_PERMILLE     700
+
+/** @brief Asagi inmeden once esigin altinda kalinmasi gereken ardisik blok sayisi */
+#define AUTORANGE_HOLD_BLOCKS       8
+
+/** @brief Acilista autorange durumu */
+#define AUTORANGE_DEFAULT_ENABLED   true
+
+/** @brief Autorange sayaclari */
+struct autorange_stats {
+    uint8_t range;                  /*!< Son blogun range'i                         */
+    uint16_t last_peak_mg;          /*!< Son blogun tepe degeri (mg)                */
+    uint32_t up_switches;           /*!< Yukari gecis                               */
+    uint32_t down_switches;         /*!< Asagi gecis                                */
+    uint32_t saturated_blocks;      /*!< Doymus ornek iceren blok                   */
+    uint32_t errors;                /*!< Yazilamayan range degisikligi              */
+    uint32_t blocks[4];             /*!< Range basina blok sayisi                   */
+};
+
+public uint8_t autorange_decide(uint8_t data_format, uint16_t peak, uint8_t *quiet_blocks);
+public void autorange_enable(bool enable);
+public bool autorange_is_enabled(void);
+public void autorange_get_stats(struct autorange_stats *stats);
+public void autorange_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AUTORANGE_H
@@ -0,0 +1,622 @@
+#include "decimator.h"
+#include "sample_pipeline.h"
+#include "fxmath.h"
+#include "utils.h"
+#include <string.h>
+#include <zephyr/kernel.h>
+
+LOG_MODULE_REGISTER(decimator, LOG_LEVEL_INF);
+
+ZBUS_CHAN_DEFINE(decim_1600hz_chan, struct decim_block, NULL, NULL, ZBUS_OBSERVERS_EMPTY, ZBUS_MSG_INIT(0));
+ZBUS_CHAN_DEFINE(decim_100hz_chan,  struct decim_block, NULL, NULL, ZBUS_OBSERVERS_EMPTY, ZBUS_MSG_INIT(0));
+ZBUS_CHAN_DEFINE(decim_25hz_chan,   struct decim_block, NULL, NULL, ZBUS_OBSERVERS_EMPTY, ZBUS_MSG_INIT(0));
+ZBUS_CHAN_DEFINE(decim_1hz_chan,    struct decim_block, NULL, NULL, ZBUS_OBSERVERS_EMPTY, ZBUS_MSG_INIT(0));
+
+/** @brief Giris asamasi yerine ham blogu gosteren ust asama degeri */
+#define DECIM_PARENT_INPUT      (-1)
+
+/** @brief Biquad katsayilarinin kesir biti */
+#define DECIM_BIQUAD_SHIFT      14
+
+/** @brief FIR tap'larinin kesir biti */
+#define DECIM_FIR_SHIFT         15
+
+/**
+ * @brief Yarim bant FIR, 15 tap, Q15 (toplam 32768: DC kazanci tam 1).
+ *
+ * 3200 Hz giriste 600 Hz'e kadar -1 dB. 1200..1600 Hz bandinda (1600 Hz
+ * ciktinin 0..400 Hz bandina katlanir) en az -47 dB: 1200 Hz'de -54.4,
+ * 1300 Hz'de -47.4, 1400 ve 1600 Hz'de -48.8 ve -48.4 dB. Merkez disindaki
+ * tek indisli tap'lar sifirdir; run_fir() yalnizca cift indisleri ve merkezi
+ * hesaplar.
+ */
+static const int16_t halfband_taps[] = {
+    -120, 0, 530, 0, -2242, 0, 9993, 16446, 9993, 0, -2242, 0, 530, 0, -120,
+};
+
+BUILD_ASSERT(ARRAY_SIZE(halfband_taps) % 4 == 3,
+             "Yarim bant FIR'in merkez tap'i tek indiste olmali");
+
+/**
+ * @brief Butterworth alcak geciren, fc 10 Hz @ fs 100 Hz, Q14.
+ *
+ * { b0, b1, b2, a1, a2 }; y = b0 x + b1 x1 + b2 x2 - a1 y1 - a2 y2.
+ * a2 DC kazanci tam 1 olacak sekilde yuvarlanmistir.
+ */
+static const int16_t lp10_biquad[] = { 1105, 2210, 1105, -18727, 6763 };
+
+/** @brief Asama tanimi (sabit) */
+struct decim_stage_cfg {
+    const char *name;
+    const struct zbus_channel *chan;
+    int8_t parent;              /*!< Ust asama veya DECIM_PARENT_INPUT          */
+    uint8_t factor;             /*!< Seyreltme orani                            */
+    uint8_t filter;             /*!< enum decim_filter                          */
+    uint8_t order;              /*!< CIC derecesi veya FIR tap sayisi           */
+    const int16_t *coeffs;      /*!< FIR tap'lari veya biquad katsayilari       */
+};
+
+static const struct decim_stage_cfg stage_cfg[DECIM_STAGE_COUNT] = {
+    [DECIM_STAGE_1600HZ] = { "1600", &decim_1600hz_chan, DECIM_PARENT_INPUT, 2,
+                             DECIM_FILTER_FIR, ARRAY_SIZE(halfband_taps), halfband_taps },
+    [DECIM_STAGE_100HZ]  = { "100",  &decim_100hz_chan,  DECIM_STAGE_1600HZ, 16,
+                             DECIM_FILTER_CIC, 3, NULL },
+    [DECIM_STAGE_25HZ]   = { "25",   &decim_25hz_chan,   DECIM_STAGE_100HZ,  4,
+                             DECIM_FILTER_BIQUAD, 0, lp10_biquad },
+    [DECIM_STAGE_1HZ]    = { "1",    &decim_1hz_chan,    DECIM_STAGE_25HZ,   25,
+                             DECIM_FILTER_CIC, 1, NULL },
+};
+
+/** @brief Asamanin degisen durumu; filtre turune gore tek alan kullanilir */
+struct decim_stage_state {
+    union {
+        struct {
+            uint32_t integ[3][DECIM_CIC_MAX_ORDER];     /*!< Tasmasi serbest integratorler  */
+            uint32_t comb[3][DECIM_CIC_MAX_ORDER];      /*!< Comb gecikmeleri               */
+            int32_t gain;                               /*!< R^N                            */
+        } cic;
+        struct {
+            int32_t delay[3][DECIM_FIR_MAX_TAPS];       /*!< Dairesel gecikme hatti         */
+            uint8_t pos;
+        } fir;
+        struct {
+            int32_t x[3][2];
+            int32_t y[3][2];
+        } biquad;
+    };
+    uint8_t phase;                                      /*!< Son ciktidan beri gelen giris  */
+    uint8_t out_count;
+    uint32_t odr_mhz;
+    int32_t out[DECIM_OUT_MAX][3];                      /*!< Alt asamalara giden cikis (Q4) */
+    struct adxl345_sample pub[DECIM_OUT_MAX];           /*!< Yayinlanan cikis (LSB)         */
+};
+
+static struct decim_stage_state stage_state[DECIM_STAGE_COUNT];
+static int32_t input_q[ADXL345_FIFO_DEPTH][3];
+
+static struct k_spinlock decim_lock;
+static uint8_t enabled_mask;
+static uint8_t active_mask;
+static bool reset_pending = true;
+static uint8_t last_bw_rate;
+static struct decim_stage_stats stage_stats[DECIM_STAGE_COUNT];
+
+
+/**
+ * @brief Asamalarin durumunu sifirlar ve cikis hizlarini giris hizindan hesaplar.
+ */
+private void reset_state( uint32_t input_odr_mhz )
+{
+    memset(stage_state, 0, sizeof(stage_state));
+
+    for (int s = 0; s < DECIM_STAGE_COUNT; s++) {
+        const struct decim_stage_cfg *cfg = &stage_cfg[s];
+        struct decim_stage_state *st = &stage_state[s];
+        uint32_t in_odr = (cfg->parent == DECIM_PARENT_INPUT) ? input_odr_mhz
+                        : stage_state[cfg->parent].odr_mhz;
+
+        st->odr_mhz = in_odr / cfg->factor;
+        if (cfg->filter == DECIM_FILTER_CIC) {
+            st->cic.gain = 1;
+            for (int n = 0; n < cfg->order; n++) {
+                st->cic.gain *= cfg->factor;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Etkin asama kumesini hesaplar: acik asamalar ve tum ust asamalari.
+ */
+private uint8_t compute_active( uint8_t enabled )
+{
+    uint8_t active = 0;
+
+    for (int s = DECIM_STAGE_COUNT - 1; s >= 0; s--) {
+        if ((enabled | active) & BIT(s)) {
+            active |= BIT(s);
+            if (stage_cfg[s].parent != DECIM_PARENT_INPUT) {
+                active |= BIT(stage_cfg[s].parent);
+            }
+        }
+    }
+    return active;
+}
+
+/**
+ * @brief CIC: her giriste N integrator, her R giriste bir N comb ve R^N bolmesi.
+ *
+ * Integratorler uint32 ile tasmaya serbest calisir; comb farklari tasmayi
+ * geri alir. Ara kazanc R^N * giris 32 bit'e sigmalidir (Q4 16 g girisle
+ * R^N <= 2^14).
+ */
+private uint8_t run_cic( const struct decim_stage_cfg *cfg , struct decim_stage_state *st ,
+                         const int32_t (*in)[3] , uint8_t count )
+{
+    uint8_t out = 0;
+
+    for (int i = 0; i < count; i++) {
+        for (int a = 0; a < 3; a++) {
+            uint32_t acc = (uint32_t)in[i][a];
+
+            for (int n = 0; n < cfg->order; n++) {
+                st->cic.integ[a][n] += acc;
+                acc = st->cic.integ[a][n];
+            }
+        }
+        if (++st->phase < cfg->factor) {
+            continue;
+        }
+        st->phase = 0;
+
+        for (int a = 0; a < 3; a++) {
+            uint32_t acc = st->cic.integ[a][cfg->order - 1];
+
+            for (int n = 0; n < cfg->order; n++) {
+                uint32_t prev = st->cic.comb[a][n];
+
+                st->cic.comb[a][n] = acc;
+                acc -= prev;
+            }
+            st->out[out][a] = (int32_t)acc / st->cic.gain;
+        }
+        out++;
+    }
+    return out;
+}
+
+/**
+ * @brief FIR: gecikme hatti her giriste guncellenir, konvolusyon yalnizca cikis anlarinda.
+ *
+ * Yarim bant tap'lari varsayilir: merkez disindaki tek indisler sifirdir ve
+ * atlanir.
+ */
+private uint8_t run_fir( const struct decim_stage_cfg *cfg , struct decim_stage_state *st ,
+                         const int32_t (*in)[3] , uint8_t count )
+{
+    const uint8_t mask = DECIM_FIR_MAX_TAPS - 1;
+    const uint8_t center = cfg->order / 2;
+    uint8_t out = 0;
+
+    for (int i = 0; i < count; i++) {
+        st->fir.pos = (st->fir.pos + 1) & mask;
+        for (int a = 0; a < 3; a++) {
+            st->fir.delay[a][st->fir.pos] = in[i][a];
+        }
+        if (++st->phase < cfg->factor) {
+            continue;
+        }
+        st->phase = 0;
+
+        for (int a = 0; a < 3; a++) {
+            const int32_t *line = st->fir.delay[a];
+            int64_t acc = 0;
+
+            for (int k = 0; k < cfg->order; k += 2) {
+                acc += (int64_t)cfg->coeffs[k] * line[(st->fir.pos - k) & mask];
+            }
+            acc += (int64_t)cfg->coeffs[center] * line[(st->fir.pos - center) & mask];
+            st->out[out][a] = (int32_t)((acc + (1 << (DECIM_FIR_SHIFT - 1))) >> DECIM_FIR_SHIFT);
+        }
+        out++;
+    }
+    return out;
+}
+
+/**
+ * @brief Biquad (DF1): her giriste filtrelenir, her `factor` giriste bir cikis alinir.
+ */
+private uint8_t run_biquad( const struct decim_stage_cfg *cfg , struct decim_stage_state *st ,
+                            const int32_t (*in)[3] , uint8_t count )
+{
+    const int16_t *c = cfg->coeffs;
+    uint8_t out = 0;
+
+    for (int i = 0; i < count; i++) {
+        bool emit = (++st->phase >= cfg->factor);
+
+        for (int a = 0; a < 3; a++) {
+            int32_t *x = st->biquad.x[a];
+            int32_t *y = st->biquad.y[a];
+            int64_t acc = (int64_t)c[0] * in[i][a] + (int64_t)c[1] * x[0] + (int64_t)c[2] * x[1]
+                        - (int64_t)c[3] * y[0] - (int64_t)c[4] * y[1];
+            int32_t result = (int32_t)((acc + (1 << (DECIM_BIQUAD_SHIFT - 1))) >> DECIM_BIQUAD_SHIFT);
+
+            x[1] = x[0];
+            x[0] = in[i][a];
+            y[1] = y[0];
+            y[0] = result;
+            if (emit) {
+                st->out[out][a] = result;
+            }
+        }
+        if (emit) {
+            st->phase = 0;
+            out++;
+        }
+    }
+    return out;
+}
+
+/**
+ * @brief Bir asamayi calistirir; cikis sayisini st->out_count'a yazar.
+ *
+ * @return Filtrede gecen cycle.
+ */
+private uint32_t run_stage( int s , const int32_t (*in)[3] , uint8_t count )
+{
+    const struct decim_stage_cfg *cfg = &stage_cfg[s];
+    struct decim_stage_state *st = &stage_state[s];
+    uint32_t start = k_cycle_get_32();
+
+    switch (cfg->filter) {
+    case DECIM_FILTER_CIC:
+        st->out_count = run_cic(cfg, st, in, count);
+        break;
+    case DECIM_FILTER_FIR:
+        st->out_count = run_fir(cfg, st, in, count);
+        break;
+    default:
+        st->out_count = run_biquad(cfg, st, in, count);
+        break;
+    }
+    return k_cycle_get_32() - start;
+}
+
+/**
+ * @brief Ham ornekleri FULL_RES LSB'ye olcekleyip Q4'e cevirir.
+ *
+ * Ornekler negatif olabildigi icin sola kaydirma (tanimsiz davranis) yerine
+ * 2'nin kuvveti ile carpilir; derleyici ayni kaydirma komutunu uretir.
+ */
+private void load_input( const struct adxl345_sample *samples , uint8_t count , uint8_t shift )
+{
+    const int32_t scale = (int32_t)1 << (shift + DECIM_FRAC_BITS);
+
+    for (int i = 0; i < count; i++) {
+        input_q[i][0] = samples[i].x * scale;
+        input_q[i][1] = samples[i].y * scale;
+        input_q[i][2] = samples[i].z * scale;
+    }
+}
+
+/**
+ * @brief Q4 cikisi yuvarlayarak 16 bit ornege cevirir.
+ */
+private int16_t to_lsb( int32_t q )
+{
+    return (int16_t)CLAMP((q + (1 << (DECIM_FRAC_BITS - 1))) >> DECIM_FRAC_BITS, INT16_MIN, INT16_MAX);
+}
+
+/**
+ * @brief Etkin asamalari agac sirasiyla calistirir.
+ *
+ * @param active    Calisacak asamalar.
+ * @param cycles    Asama basina harcanan cycle (eklenir).
+ */
+private void run_graph( uint8_t count , uint8_t active , uint32_t cycles[DECIM_STAGE_COUNT] )
+{
+    for (int s = 0; s < DECIM_STAGE_COUNT; s++) {
+        const struct decim_stage_cfg *cfg = &stage_cfg[s];
+        const int32_t (*in)[3] = input_q;
+        uint8_t in_count = count;
+
+        stage_state[s].out_count = 0;
+        if (!(active & BIT(s))) {
+            continue;
+        }
+        if (cfg->parent != DECIM_PARENT_INPUT) {
+            in = (const int32_t (*)[3])stage_state[cfg->parent].out;
+            in_count = stage_state[cfg->parent].out_count;
+        }
+        if (in_count) {
+            cycles[s] += run_stage(s, in, in_count);
+        }
+    }
+}
+
+/**
+ * @brief Bir FIFO blogunu asama agacindan gecirir ve acik asamalarin ciktisini yayinlar.
+ *
+ * ODR degisirse filtre durumu sifirlanir; range/FULL_RES degisimi ornekler
+ * FULL_RES LSB'ye olceklendigi icin durumu bozmaz.
+ */
+private void decim_block_cb( const struct zbus_channel *chan )
+{
+    const struct adxl345_block *block = zbus_chan_const_msg(chan);
+    uint32_t cycles[DECIM_STAGE_COUNT] = { 0 };
+    uint32_t inputs[DECIM_STAGE_COUNT] = { 0 };
+
+    k_spinlock_key_t key = k_spin_lock(&decim_lock);
+    uint8_t enabled = enabled_mask;
+    uint8_t active = active_mask;
+    bool reset = reset_pending || block->bw_rate != last_bw_rate;
+
+    reset_pending = false;
+    last_bw_rate = block->bw_rate;
+    k_spin_unlock(&decim_lock, key);
+
+    if (!active || block->count == 0) {
+        return;
+    }
+    if (reset) {
+        reset_state(adxl345_odr_mhz(block->bw_rate));
+    }
+
+    load_input(block->samples, block->count, adxl345_lsb_shift(block->data_format));
+    run_graph(block->count, active, cycles);
+
+    for (int s = 0; s < DECIM_STAGE_COUNT; s++) {
+        struct decim_stage_state *st = &stage_state[s];
+        int8_t parent = stage_cfg[s].parent;
+
+        inputs[s] = (parent == DECIM_PARENT_INPUT) ? block->count : stage_state[parent].out_count;
+        if (!(enabled & BIT(s)) || st->out_count == 0) {
+            continue;
+        }
+
+        for (int i = 0; i < st->out_count; i++) {
+            st->pub[i].x = to_lsb(st->out[i][0]);
+            st->pub[i].y = to_lsb(st->out[i][1]);
+            st->pub[i].z = to_lsb(st->out[i][2]);
+        }
+
+        struct decim_block out = {
+            .samples    = st->pub,
+            .count      = st->out_count,
+            .stage      = s,
+            .odr_mhz    = st->odr_mhz,
+            .seq        = block->seq,
+            .timestamp  = block->timestamp,
+        };
+        zbus_chan_pub(stage_cfg[s].chan, &out, K_NO_WAIT);
+    }
+
+    key = k_spin_lock(&decim_lock);
+    for (int s = 0; s < DECIM_STAGE_COUNT; s++) {
+        if (active & BIT(s)) {
+            stage_stats[s].inputs += inputs[s];
+            stage_stats[s].outputs += stage_state[s].out_count;
+            stage_stats[s].cycles += cycles[s];
+        }
+    }
+    k_spin_unlock(&decim_lock, key);
+}
+
+ZBUS_LISTENER_DEFINE(decim_listener, decim_block_cb);
+ZBUS_CHAN_ADD_OBS(adxl_block_chan, decim_listener, 5);
+
+
+/**
+ * @brief Bir asamanin yayinini acar veya kapatir.
+ *
+ * Acik asamanin tum ust asamalari da hesaplanir; hicbir alt asamasi acik
+ * olmayan kapali asama hesaplanmaz. Yeni hesaplanmaya baslayan asamalarin
+ * gecmisi gecersiz oldugundan filtre durumu sifirlanir.
+ */
+public void decim_set_enabled(uint8_t stage, bool enable)
+{
+    if (stage >= DECIM_STAGE_COUNT) {
+        return;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&decim_lock);
+    enabled_mask = enable ? (enabled_mask | BIT(stage)) : (enabled_mask & ~BIT(stage));
+
+    uint8_t active = compute_active(enabled_mask);
+    if (active & ~active_mask) {
+        reset_pending = true;
+    }
+    active_mask = active;
+    k_spin_unlock(&decim_lock, key);
+}
+
+/**
+ * @brief Asama yayinlaniyor mu (kendisi acik) veya bir alt asama icin hesaplaniyor mu.
+ */
+public bool decim_is_active(uint8_t stage)
+{
+    return stage < DECIM_STAGE_COUNT && (active_mask & BIT(stage));
+}
+
+/**
+ * @brief Filtre durumunu ve sayaclari sifirlar; durum bir sonraki blokta sifirlanir.
+ */
+public void decim_reset(void)
+{
+    k_spinlock_key_t key = k_spin_lock(&decim_lock);
+    reset_pending = true;
+    memset(stage_stats, 0, sizeof(stage_stats));
+    k_spin_unlock(&decim_lock, key);
+}
+
+public void decim_get_stats(uint8_t stage, struct decim_stage_stats *stats)
+{
+    if (stage >= DECIM_STAGE_COUNT) {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&decim_lock);
+    *stats = stage_stats[stage];
+    k_spin_unlock(&decim_lock, key);
+}
+
+public const char *decim_stage_name(uint8_t stage)
+{
+    return (stage < DECIM_STAGE_COUNT) ? stage_cfg[stage].name : "?";
+}
+
+
+#if defined(CONFIG_SHELL)
+#include <zephyr/shell/shell.h>
+
+/** @brief Benchmark: 3200 Hz'de 1 s sentetik veri (100 x 32 ornek) */
+#define DECIM_BENCH_BLOCKS      100
+#define DECIM_BENCH_ODR_MHZ     3200000
+
+/**
+ * @brief Benchmark girisi: z ekseninde 1 g, x'te 50 Hz, y'de 1 kHz sinus (FULL_RES LSB).
+ */
+private void bench_block( struct adxl345_sample *samples , uint32_t base )
+{
+    for (int i = 0; i < ADXL345_FIFO_DEPTH; i++) {
+        uint32_t n = base + i;
+
+        samples[i].x = (int16_t)(fx_sin_q15((uint16_t)(n * 1024)) >> 6);        /* 50 Hz   */
+        samples[i].y = (int16_t)(fx_sin_q15((uint16_t)(n * 20480)) >> 7);       /* 1000 Hz */
+        samples[i].z = 256;
+    }
+}
+
+/**
+ * @brief Her asama ve her yapilandirma icin giris ornegi basina cycle olcer.
+ *
+ * Yapilandirma, bir asamanin acilmasiyla calisan asama zinciridir (ornegin
+ * 25 Hz: 1600 + 100 + 25). Zincir maliyeti ham giris ornegi basina,
+ * asama maliyeti asamanin kendi girisi basina raporlanir. Canli filtre
+ * durumu kullanildigi icin pipeline durdurulmus olmalidir.
+ */
+private int cmd_decim_bench(const struct shell *sh, size_t argc, char **argv)
+{
+    static struct adxl345_sample samples[ADXL345_FIFO_DEPTH];
+    uint32_t raw = DECIM_BENCH_BLOCKS * ADXL345_FIFO_DEPTH;
+
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    if (sample_pipeline_is_running()) {
+        shell_error(sh, "Once pipeline'i durdurun (adxl pipeline stop)");
+        return -EBUSY;
+    }
+
+    shell_print(sh, "yapilandirma  zincir cyc/ornek | asama: cyc/giris ornegi");
+    for (int target = 0; target < DECIM_STAGE_COUNT; target++) {
+        uint8_t active = compute_active(BIT(target));
+        uint32_t cycles[DECIM_STAGE_COUNT] = { 0 };
+        uint32_t inputs[DECIM_STAGE_COUNT] = { 0 };
+        uint64_t total = 0;
+
+        reset_state(DECIM_BENCH_ODR_MHZ);
+        for (uint32_t b = 0; b < DECIM_BENCH_BLOCKS; b++) {
+            bench_block(samples, b * ADXL345_FIFO_DEPTH);
+            load_input(samples, ADXL345_FIFO_DEPTH, 0);
+            run_graph(ADXL345_FIFO_DEPTH, active, cycles);
+            for (int s = 0; s < DECIM_STAGE_COUNT; s++) {
+                int8_t parent = stage_cfg[s].parent;
+
+                if (active & BIT(s)) {
+                    inputs[s] += (parent == DECIM_PARENT_INPUT) ? ADXL345_FIFO_DEPTH
+                               : stage_state[parent].out_count;
+                }
+            }
+        }
+
+        char line[64];
+        int len = 0;
+
+        for (int s = 0; s < DECIM_STAGE_COUNT; s++) {
+            if (!(active & BIT(s)) || inputs[s] == 0) {
+                continue;
+            }
+            total += cycles[s];
+            len += snprintk(line + len, sizeof(line) - len, " %s:%u", stage_cfg[s].name,
+                            cycles[s] / inputs[s]);
+        }
+        shell_print(sh, "%5s Hz      %5u           |%s", stage_cfg[target].name,
+                    (uint32_t)(total / raw), line);
+    }
+
+    decim_reset();
+    return 0;
+}
+
+private int cmd_decim_show(const struct shell *sh, size_t argc, char **argv)
+{
+    bool reset = (argc > 1 && strcmp(argv[1], "reset") == 0);
+
+    shell_print(sh, "asama  filtre   /R  durum        giris     cikis  cyc/giris");
+    for (int s = 0; s < DECIM_STAGE_COUNT; s++) {
+        static const char *const filters[] = { "CIC", "FIR", "biquad" };
+        const struct decim_stage_cfg *cfg = &stage_cfg[s];
+        struct decim_stage_stats st;
+
+        decim_get_stats(s, &st);
+        shell_print(sh, "%4s  %-7s %3u  %-10s %8u  %8u  %5u", cfg->name, filters[cfg->filter], cfg->factor,
+                    (enabled_mask & BIT(s)) ? "acik" : decim_is_active(s) ? "ara asama" : "kapali",
+                    st.inputs, st.outputs, st.inputs ? (uint32_t)(st.cycles / st.inputs) : 0);
+    }
+    if (reset) {
+        decim_reset();
+    }
+    return 0;
+}
+
+/**
+ * @brief Asama adini (1600, 100, 25, 1) indekse cevirir.
+ */
+private int parse_stage( const struct shell *sh , const char *name )
+{
+    for (int s = 0; s < DECIM_STAGE_COUNT; s++) {
+        if (strcmp(name, stage_cfg[s].name) == 0) {
+            return s;
+        }
+    }
+    shell_error(sh, "Bilinmeyen asama: %s (1600, 100, 25, 1)", name);
+    return -EINVAL;
+}
+
+private int cmd_decim_on(const struct shell *sh, size_t argc, char **argv)
+{
+    int stage = parse_stage(sh, argv[1]);
+
+    if (stage < 0) {
+        return stage;
+    }
+    decim_set_enabled(stage, true);
+    shell_print(sh, "%s Hz asamasi acik", argv[1]);
+    return 0;
+}
+
+private int cmd_decim_off(const struct shell *sh, size_t argc, char **argv)
+{
+    int stage = parse_stage(sh, argv[1]);
+
+    if (stage < 0) {
+        return stage;
+    }
+    decim_set_enabled(stage, false);
+    shell_print(sh, "%s Hz asamasi kapali", argv[1]);
+    return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_decim,
+    SHELL_CMD_ARG(show,  NULL, "Asamalar ve sayaclar: show [reset]",        cmd_decim_show,  1, 1),
+    SHELL_CMD_ARG(on,    NULL, "Asama yayinini ac: on <1600|100|25|1>",     cmd_decim_on,    2, 0),
+    SHELL_CMD_ARG(off,   NULL, "Asama yayinini kapat: off <1600|100|25|1>", cmd_decim_off,   2, 0),
+    SHELL_CMD_ARG(bench, NULL, "Yapilandirma basina cycle/ornek",           cmd_decim_bench, 1, 0),
+    SHELL_SUBCMD_SET_END
+);
+
+SHELL_SUBCMD_ADD((adxl), decim, &sub_decim, "Seyreltme ve filtre asamalari", NULL, 0, 0);
+#endif
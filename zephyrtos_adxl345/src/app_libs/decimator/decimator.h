@@ -0,0 +1,94 @@
+/**
+ * @file decimator.h
+ * @brief Sabit noktali filtre ve seyreltme (decimation) asamalari
+ *
+ * FIFO bloklari ile tuketiciler arasinda, tek bir sensor akisindan farkli
+ * hizlar ureten asama agaci. Her asama ust asamanin (veya ham blogun)
+ * ciktisini bir filtreden (CIC, FIR veya biquad) gecirir ve `factor` kadar
+ * seyreltir. 3200 Hz girisle varsayilan agac:
+ *
+ *   giris 3200 Hz -> FIR yarim bant /2   -> 1600 Hz (titresim)
+ *                 -> CIC N=3 /16         ->  100 Hz
+ *                 -> biquad LP 10 Hz /4  ->   25 Hz (siniflandirici)
+ *                 -> CIC N=1 /25         ->    1 Hz (kayit ozeti, ortalama)
+ *
+ * Her asamanin ciktisi kendi zbus kanalina yayinlanir; tuketici istedigi
+ * hizin kanalina listener ekler. Bir asamanin filtre durumu tek kopyadir,
+ * ayni hizdaki tum tuketiciler ayni hesabi paylasir. Kapali bir asama, alt
+ * asamalarindan biri acik degilse hic hesaplanmaz.
+ *
+ * Hizlar giris ODR'sine oranlidir; gercek hiz `decim_block.odr_mhz` ile gelir.
+ * Ornekler FULL_RES LSB (3.9 mg) cinsindendir; asamalar arasi 4 kesir bitli
+ * 32 bit tamsayi tasinir.
+ */
+#ifndef DECIMATOR_H
+#define DECIMATOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "adxl345.h"
+#include <zephyr/zbus/zbus.h>
+
+/** @brief Asamalar arasi tasinan ornekteki kesir biti */
+#define DECIM_FRAC_BITS         4
+
+/** @brief Sinirlar */
+#define DECIM_CIC_MAX_ORDER     4
+#define DECIM_FIR_MAX_TAPS      16
+
+/** @brief Bir asamanin blok basina en fazla ciktisi (her asama en az /2 seyreltir) */
+#define DECIM_OUT_MAX           (ADXL345_FIFO_DEPTH / 2)
+
+/** @brief Asama tanimlari (agac sirasi: ust asama her zaman once gelir) */
+enum decim_stage {
+    DECIM_STAGE_1600HZ = 0,
+    DECIM_STAGE_100HZ,
+    DECIM_STAGE_25HZ,
+    DECIM_STAGE_1HZ,
+    DECIM_STAGE_COUNT,
+};
+
+/** @brief Filtre turleri */
+enum decim_filter {
+    DECIM_FILTER_CIC = 0,   /*!< N dereceli integrator-comb, carpmasiz                   */
+    DECIM_FILTER_FIR,       /*!< Q15 tap'li FIR, yalnizca cikis anlarinda hesaplanir     */
+    DECIM_FILTER_BIQUAD,    /*!< Q14 katsayili ikinci derece IIR (DF1), her girdide      */
+};
+
+/**
+ * @brief Bir asamanin ciktisi.
+ *
+ * `samples` asamanin tamponunu gosterir ve yalnizca listener geri cagirmasi
+ * suresince gecerlidir.
+ */
+struct decim_block {
+    const struct adxl345_sample *samples;   /*!< Filtreli ornekler (FULL_RES LSB)     */
+    uint8_t count;                          /*!< Ornek sayisi                         */
+    uint8_t stage;                          /*!< enum decim_stage                     */
+    uint32_t odr_mhz;                       /*!< Cikis hizi (mHz)                     */
+    uint32_t seq;                           /*!< Kaynak FIFO blogunun sira numarasi   */
+    uint32_t timestamp;                     /*!< Kaynak FIFO blogunun zamani (ms)     */
+};
+
+/** @brief Asama sayaclari */
+struct decim_stage_stats {
+    uint32_t inputs;                        /*!< Islenen giris ornegi                 */
+    uint32_t outputs;                       /*!< Uretilen cikis ornegi                */
+    uint64_t cycles;                        /*!< Filtrede gecen toplam cycle          */
+};
+
+ZBUS_CHAN_DECLARE(decim_1600hz_chan, decim_100hz_chan, decim_25hz_chan, decim_1hz_chan);
+
+public void decim_set_enabled(uint8_t stage, bool enable);
+public bool decim_is_active(uint8_t stage);
+public void decim_reset(void);
+public void decim_get_stats(uint8_t stage, struct decim_stage_stats *stats);
+public const char *decim_stage_name(uint8_t stage);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DECIMATOR_H
@@ -0,0 +1,527 @@
+#include "energy.h"
+#include "sample_pipeline.h"
+#include "gpio_settings.h"
+#include "utils.h"
+#include <zephyr/kernel.h>
+
+LOG_MODULE_REGISTER(energy, LOG_LEVEL_INF);
+
+
+/** @brief ADXL345 akimi (uA), normal mod; indeks BW_RATE hiz kodu (datasheet Tablo 7) */
+static const uint8_t adxl_normal_ua[16] = {
+    23, 23, 23, 23, 34, 40, 45, 50, 60, 90, 140, 140, 140, 140, 90, 140,
+};
+
+/** @brief LOW_POWER modunda akim (uA); 12.5..400 Hz disinda bitin etkisi yoktur (Tablo 8) */
+static const uint8_t adxl_low_power_ua[16] = {
+    23, 23, 23, 23, 34, 40, 45, 34, 40, 45, 50, 60, 90, 140, 90, 140,
+};
+
+static struct energy_model active_model = {
+    .battery_mah        = ENERGY_DEFAULT_BATTERY_MAH,
+    .adxl_sleep_na      = ENERGY_DEFAULT_ADXL_SLEEP_NA,
+    .adxl_standby_na    = ENERGY_DEFAULT_ADXL_STANDBY_NA,
+    .bus_active_na      = ENERGY_DEFAULT_BUS_ACTIVE_NA,
+    .cpu_active_na      = ENERGY_DEFAULT_CPU_ACTIVE_NA,
+    .cpu_idle_na        = ENERGY_DEFAULT_CPU_IDLE_NA,
+    .cpu_wake_us        = ENERGY_DEFAULT_CPU_WAKE_US,
+    .cpu_sample_ns      = ENERGY_DEFAULT_CPU_SAMPLE_NS,
+};
+
+/** @brief energy_reset() anindaki sayaclar; olcum bunlara gore farktir */
+static struct energy_counters base;
+static atomic_t sample_count;
+
+
+/**
+ * @brief Bir guc durumundaki sensor akimini dondurur.
+ *
+ * @param model     Akim modeli.
+ * @param pstate    ADXL345_PSTATE_* veya BW_RATE'in hiz ve LOW_POWER bitleri.
+ * @return Akim (nA).
+ */
+public uint32_t energy_adxl_current_na(const struct energy_model *model, uint8_t pstate)
+{
+    if (pstate == ADXL345_PSTATE_SLEEP) {
+        return model->adxl_sleep_na;
+    }
+    if (pstate >= ADXL345_PSTATE_STANDBY) {
+        return model->adxl_standby_na;
+    }
+
+    const uint8_t *table = (pstate & ADXL_BW_RATE_LOW_POWER) ? adxl_low_power_ua : adxl_normal_ua;
+
+    return table[pstate & ADXL_BW_RATE_3200HZ] * 1000U;
+}
+
+/**
+ * @brief Guc durumu sureleri ve sayaclardan ortalama akimi ve pil omrunu hesaplar.
+ *
+ * Hat suresi bit sayisindan ve devicetree'deki hat frekansindan bulunur; CPU
+ * aktarim boyunca aktif sayilir (bloklayan aktarim). Aralik, durum surelerinin
+ * toplamidir.
+ *
+ * @param model     Akim modeli.
+ * @param res       Aralik boyunca guc durumu sureleri.
+ * @param counters  Aralik boyunca biriken sayaclar.
+ * @param[out] out  Sonuc.
+ */
+public void energy_estimate(const struct energy_model *model, const struct adxl345_residency *res,
+                            const struct energy_counters *counters, struct energy_report *out)
+{
+    uint64_t elapsed = 0;
+    uint64_t sensor_q = 0;      /* nA x us */
+    uint64_t asleep = 0;
+
+    for (int i = 0; i < ADXL345_PSTATE_COUNT; i++) {
+        elapsed += res->us[i];
+        sensor_q += res->us[i] * energy_adxl_current_na(model, i);
+    }
+    asleep = res->us[ADXL345_PSTATE_SLEEP] + res->us[ADXL345_PSTATE_STANDBY];
+
+    uint64_t bus_us = (counters->wire_bits * 1000000ULL) / ADXL345_BUS_FREQ_HZ;
+    uint64_t cpu_us = bus_us + (uint64_t)counters->wakeups * model->cpu_wake_us +
+                      ((uint64_t)counters->samples * model->cpu_sample_ns) / 1000U;
+
+    cpu_us = MIN(cpu_us, elapsed);
+
+    *out = (struct energy_report) {
+        .elapsed_us     = elapsed,
+        .bus_us         = bus_us,
+        .cpu_active_us  = cpu_us,
+        .counters       = *counters,
+    };
+    if (elapsed == 0) {
+        return;
+    }
+
+    out->sleep_permille = (uint32_t)((asleep * 1000U) / elapsed);
+    out->sensor_na = (uint32_t)(sensor_q / elapsed);
+    out->bus_na = (uint32_t)((bus_us * model->bus_active_na) / elapsed);
+    out->cpu_na = (uint32_t)((cpu_us * model->cpu_active_na + (elapsed - cpu_us) * model->cpu_idle_na) / elapsed);
+    out->total_na = out->sensor_na + out->bus_na + out->cpu_na;
+
+    /* mAh -> nAh: x 10^6 */
+    uint64_t life_h = out->total_na ? ((uint64_t)model->battery_mah * 1000000U) / out->total_na : UINT32_MAX;
+
+    out->life_h = (uint32_t)MIN(life_h, UINT32_MAX);
+}
+
+public void energy_get_model(struct energy_model *model)
+{
+    *model = active_model;
+}
+
+/**
+ * @brief Surucu sayaclarinin anlik degerlerini toplar.
+ */
+private void read_counters( struct energy_counters *out )
+{
+    struct adxl345_stats stats;
+
+    adxl345_get_stats(&stats);
+    out->wire_bits = stats.wire_bits;
+    out->transfers = stats.read_count + stats.write_count;
+    out->wakeups = adxl_irq_count();
+    out->samples = (uint32_t)atomic_get(&sample_count);
+}
+
+/**
+ * @brief Olcum araligini baslatir: guc durumu sureleri sifirlanir, sayaclar kaydedilir.
+ *
+ * Surucunun hat istatistikleri (`adxl stats`) sifirlanmaz.
+ */
+public void energy_reset(void)
+{
+    read_counters(&base);
+    adxl345_reset_residency();
+}
+
+/**
+ * @brief energy_reset()'ten bu yana gecen aralik icin gecerli modelle tahmin yapar.
+ */
+public void energy_measure(struct energy_report *out)
+{
+    struct adxl345_residency res;
+    struct energy_counters now;
+
+    adxl345_get_residency(&res);
+    read_counters(&now);
+
+    struct energy_counters delta = {
+        .wire_bits  = now.wire_bits - base.wire_bits,
+        .transfers  = now.transfers - base.transfers,
+        .wakeups    = now.wakeups - base.wakeups,
+        .samples    = now.samples - base.samples,
+    };
+
+    energy_estimate(&active_model, &res, &delta, out);
+}
+
+/**
+ * @brief Yayinlanan ornekleri sayar (CPU is yukunun girdisi).
+ */
+private void energy_block_cb( const struct zbus_channel *chan )
+{
+    const struct adxl345_block *block = zbus_chan_const_msg(chan);
+
+    atomic_add(&sample_count, block->count);
+}
+
+ZBUS_LISTENER_DEFINE(energy_listener, energy_block_cb);
+ZBUS_CHAN_ADD_OBS(adxl_block_chan, energy_listener, 6);
+
+
+#if defined(CONFIG_SHELL)
+#include <zephyr/shell/shell.h>
+#include <string.h>
+
+/**
+ * @brief nA degerini iki ondalikli uA olarak yazar.
+ */
+private const char *format_ua( char *buf , size_t len , uint32_t na )
+{
+    snprintk(buf, len, "%u.%02u", na / 1000U, (na % 1000U) / 10U);
+    return buf;
+}
+
+/**
+ * @brief BW_RATE degerini "100.0 LP" bicimiyle yazar.
+ */
+private void format_rate( char *buf , size_t len , uint8_t bw_rate )
+{
+    uint32_t odr = adxl345_odr_mhz(bw_rate);
+
+    snprintk(buf, len, "%u.%u%s", odr / 1000U, (odr % 1000U) / 100U,
+             (bw_rate & ADXL_BW_RATE_LOW_POWER) ? " LP" : "");
+}
+
+private void print_report( const struct shell *sh , const struct energy_report *rep )
+{
+    char ua[4][12];
+
+    shell_print(sh, "aralik      : %llu ms, sensor %u.%u%% uyku/standby", rep->elapsed_us / 1000U,
+                rep->sleep_permille / 10U, rep->sleep_permille % 10U);
+    shell_print(sh, "sayaclar    : %u hat islemi (%llu us), %u uyanma, %u ornek, CPU aktif %llu us",
+                rep->counters.transfers, rep->bus_us, rep->counters.wakeups, rep->counters.samples,
+                rep->cpu_active_us);
+    shell_print(sh, "ortalama    : sensor %s, hat %s, CPU %s, toplam %s uA",
+                format_ua(ua[0], sizeof(ua[0]), rep->sensor_na), format_ua(ua[1], sizeof(ua[1]), rep->bus_na),
+                format_ua(ua[2], sizeof(ua[2]), rep->cpu_na), format_ua(ua[3], sizeof(ua[3]), rep->total_na));
+    shell_print(sh, "pil omru    : %u gun (%u mAh)", rep->life_h / 24U, active_model.battery_mah);
+}
+
+private int cmd_energy_show(const struct shell *sh, size_t argc, char **argv)
+{
+    struct adxl345_residency res;
+    struct energy_report rep;
+
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    energy_measure(&rep);
+    print_report(sh, &rep);
+
+    adxl345_get_residency(&res);
+    shell_print(sh, "durum          sure (ms)   akim (uA)");
+    for (int i = 0; i < ADXL345_PSTATE_COUNT; i++) {
+        char name[16];
+        char ua[12];
+
+        if (res.us[i] == 0) {
+            continue;
+        }
+        if (i == ADXL345_PSTATE_SLEEP) {
+            strcpy(name, "uyku");
+        } else if (i == ADXL345_PSTATE_STANDBY) {
+            strcpy(name, "standby");
+        } else {
+            format_rate(name, sizeof(name), i);
+        }
+        shell_print(sh, "%-10s%c %12llu   %9s", name, (i == res.state) ? '*' : ' ', res.us[i] / 1000U,
+                    format_ua(ua, sizeof(ua), energy_adxl_current_na(&active_model, i)));
+    }
+    return 0;
+}
+
+private int cmd_energy_reset(const struct shell *sh, size_t argc, char **argv)
+{
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    energy_reset();
+    shell_print(sh, "Olcum araligi baslatildi");
+    return 0;
+}
+
+/** @brief `adxl energy set` ile degistirilebilen model alanlari */
+static const struct {
+    const char *name;
+    uint32_t *value;
+    const char *unit;
+} model_fields[] = {
+    { "battery",    &active_model.battery_mah,     "mAh" },
+    { "sleep",      &active_model.adxl_sleep_na,   "nA"  },
+    { "standby",    &active_model.adxl_standby_na, "nA"  },
+    { "bus",        &active_model.bus_active_na,   "nA"  },
+    { "cpu",        &active_model.cpu_active_na,   "nA"  },
+    { "idle",       &active_model.cpu_idle_na,     "nA"  },
+    { "wake",       &active_model.cpu_wake_us,     "us"  },
+    { "sample",     &active_model.cpu_sample_ns,   "ns"  },
+};
+
+private int cmd_energy_model(const struct shell *sh, size_t argc, char **argv)
+{
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    for (size_t i = 0; i < ARRAY_SIZE(model_fields); i++) {
+        shell_print(sh, "%-8s %10u %s", model_fields[i].name, *model_fields[i].value, model_fields[i].unit);
+    }
+    shell_print(sh, "hat      %10u Hz (devicetree)", (uint32_t)ADXL345_BUS_FREQ_HZ);
+    return 0;
+}
+
+private int cmd_energy_set(const struct shell *sh, size_t argc, char **argv)
+{
+    int err = 0;
+    unsigned long value = shell_strtoul(argv[2], 0, &err);
+
+    ARG_UNUSED(argc);
+    if (err || value > UINT32_MAX) {
+        shell_error(sh, "Gecersiz deger: %s", argv[2]);
+        return -EINVAL;
+    }
+    for (size_t i = 0; i < ARRAY_SIZE(model_fields); i++) {
+        if (strcmp(argv[1], model_fields[i].name) == 0) {
+            *model_fields[i].value = (uint32_t)value;
+            return 0;
+        }
+    }
+    shell_error(sh, "Bilinmeyen alan: %s (adxl energy model)", argv[1]);
+    return -EINVAL;
+}
+
+
+#if defined(CONFIG_EMUL)
+#include "adxl345_emul.h"
+#include "impact.h"
+#include "fxmath.h"
+
+/** @brief Hareket izinin ornekleme hizi (Hz) */
+#define ENERGY_TRACE_RATE_HZ    10
+
+/** @brief Hareket izinin bir bolumu */
+struct energy_segment {
+    uint16_t duration_s;
+    uint16_t cadence_spm;       /*!< Salinim hizi (adim/dk); 0 ise yalnizca gurultu */
+    uint16_t amplitude_mg;      /*!< Yatay (X/Y) salinim genligi                    */
+    uint16_t noise_mg;          /*!< Her eksene eklenen gurultu genligi             */
+};
+
+/**
+ * @brief Bench senaryosu: masada bekleme, yurume, elde tasima.
+ *
+ * Init ayarinda aktivite/inaktivite yalnizca X ve Y eksenlerinde DC modda
+ * karsilastirildigi icin hareket bu eksenlere verilir. Yurume (400 mg) 250 mg
+ * esigi asar, 500 mg'yi asmaz; elde tasima (180 mg) yalnizca 125 mg esigini
+ * asar. Bekleme bolumleri TIME_INACT'tan (10 sn) uzundur.
+ */
+static const struct energy_segment energy_scenario[] = {
+    { 30,   0,   0,  8 },   /* masada                   */
+    { 20, 110, 400, 40 },   /* yurume                   */
+    { 25,   0,   0,  8 },   /* masada                   */
+    { 10,  40, 180, 20 },   /* elde tasima, yavas salinim */
+    { 35,   0,   0,  8 },   /* masada                   */
+};
+
+/** @brief Senaryo suresi (sn): bolum sureleri toplami */
+#define ENERGY_SCENARIO_S       120
+
+static struct adxl345_sample energy_trace[ENERGY_SCENARIO_S * ENERGY_TRACE_RATE_HZ];
+
+/** @brief Bench izgarasi */
+static const uint8_t bench_rates[] = {
+    ADXL_BW_RATE_12_5HZ | ADXL_BW_RATE_LOW_POWER,
+    ADXL_BW_RATE_25HZ | ADXL_BW_RATE_LOW_POWER,
+    ADXL_BW_RATE_100HZ | ADXL_BW_RATE_LOW_POWER,
+    ADXL_BW_RATE_100HZ,
+    ADXL_BW_RATE_400HZ,
+};
+static const uint8_t bench_watermarks[] = { 4, 16, 31 };
+static const uint16_t bench_thresh_mg[] = { 125, 250, 500 };
+
+/**
+ * @brief Tekrarlanabilir gurultu icin dogrusal esliksiz uretec (LCG).
+ */
+private int32_t trace_noise( uint32_t *state , uint16_t amplitude )
+{
+    *state = *state * 1664525U + 1013904223U;
+    if (amplitude == 0) {
+        return 0;
+    }
+    return (int32_t)((*state >> 16) % (2U * amplitude + 1U)) - amplitude;
+}
+
+/**
+ * @brief Senaryodan ENERGY_TRACE_RATE_HZ hizinda hareket izini uretir.
+ */
+private uint32_t build_trace( void )
+{
+    uint32_t n = 0;
+    uint32_t rng = 1;
+
+    for (size_t s = 0; s < ARRAY_SIZE(energy_scenario); s++) {
+        const struct energy_segment *seg = &energy_scenario[s];
+
+        for (uint32_t i = 0; i < seg->duration_s * ENERGY_TRACE_RATE_HZ && n < ARRAY_SIZE(energy_trace); i++) {
+            uint16_t phase = (uint16_t)(((uint64_t)i * seg->cadence_spm * 65536U) / (60U * ENERGY_TRACE_RATE_HZ));
+            int32_t swing = (seg->amplitude_mg * fx_sin_q15(phase)) >> 15;
+
+            energy_trace[n++] = (struct adxl345_sample) {
+                .x = (int16_t)(swing / 3 + trace_noise(&rng, seg->noise_mg)),
+                .y = (int16_t)(swing + trace_noise(&rng, seg->noise_mg)),
+                .z = (int16_t)(1000 + swing / 2 + trace_noise(&rng, seg->noise_mg)),
+            };
+        }
+    }
+    return n;
+}
+
+/**
+ * @brief Tek bir ayar kombinasyonunu senaryo uzerinde calistirir ve olcer.
+ *
+ * Sensor standby'a alinir, esikler ve FIFO toplama kurulur, iz basa sarilir
+ * ve olcum yeniden baslatilir (sensor uyanik baslar). Aktivite esigi verilen
+ * deger, inaktivite esigi yarisidir.
+ */
+private int bench_run( uint8_t bw_rate , uint8_t watermark , uint16_t thresh_mg , uint32_t duration_s ,
+                       uint32_t trace_len , struct energy_report *rep )
+{
+    /* 62.5 mg/LSB: mg * 2 / 125 */
+    uint8_t thresh = (uint8_t)MIN((thresh_mg * 2 + 62) / 125, ADXL_THRESH_ACT_MAX);
+    int err = adxl345_update_reg(ADXL345_POWER_CTL, ADXL_POWER_CTL_MEASURE, 0);
+
+    if (!err) {
+        err = adxl345_set_thresh_act(thresh);
+    }
+    if (!err) {
+        err = adxl345_set_thresh_inact(MAX(thresh / 2, 1));
+    }
+    if (!err) {
+        err = sample_pipeline_start(bw_rate, watermark);
+    }
+    if (err) {
+        return err;
+    }
+
+    adxl345_emul_set_trace(energy_trace, trace_len);
+    err = adxl345_update_reg(ADXL345_POWER_CTL, ADXL_POWER_CTL_MEASURE, ADXL_POWER_CTL_MEASURE);
+    if (!err) {
+        energy_reset();
+        k_sleep(K_SECONDS(duration_s));
+        energy_measure(rep);
+    }
+    sample_pipeline_stop();
+    return err;
+}
+
+/**
+ * @brief BW_RATE x watermark x esik izgarasini ayni hareket izi uzerinde calistirir.
+ *
+ * Iz ODR'den bagimsiz, gercek zamanda oynatilir; boylece her kombinasyon ayni
+ * hareketi gorur. Sure verilmezse senaryo bir kez oynatilir. Pipeline ve
+ * darbe kaydi kapali olmalidir; bitince ayarlar ve varsayilan iz geri yuklenir.
+ */
+private int cmd_energy_bench(const struct shell *sh, size_t argc, char **argv)
+{
+    int err = 0;
+    uint32_t duration_s = ENERGY_SCENARIO_S;
+    struct adxl345_config saved;
+
+    if (argc > 1) {
+        duration_s = shell_strtoul(argv[1], 0, &err);
+        if (err || duration_s == 0) {
+            shell_error(sh, "Gecersiz sure: %s", argv[1]);
+            return -EINVAL;
+        }
+    }
+    if (sample_pipeline_is_running() || impact_is_armed()) {
+        shell_error(sh, "Once pipeline durdurulmali / darbe kaydi kaldirilmali");
+        return -EBUSY;
+    }
+
+    uint32_t trace_len = build_trace();
+    uint32_t best_life = 0;
+    char best[40] = "";
+
+    adxl345_get_config(&saved);
+    adxl345_emul_set_trace_rate(ENERGY_TRACE_RATE_HZ * 1000U);
+
+    shell_print(sh, "%u sn, iz %u ornek @ %u Hz, pil %u mAh", duration_s, trace_len, ENERGY_TRACE_RATE_HZ,
+                active_model.battery_mah);
+    shell_print(sh, "ODR (Hz)   wm  esik   uyku  sensor     hat     CPU  toplam (uA)   omur (gun)");
+
+    for (size_t r = 0; r < ARRAY_SIZE(bench_rates) && !err; r++) {
+        for (size_t w = 0; w < ARRAY_SIZE(bench_watermarks) && !err; w++) {
+            for (size_t t = 0; t < ARRAY_SIZE(bench_thresh_mg) && !err; t++) {
+                struct energy_report rep;
+                char rate[16];
+                char ua[4][12];
+
+                err = bench_run(bench_rates[r], bench_watermarks[w], bench_thresh_mg[t], duration_s,
+                                trace_len, &rep);
+                if (err) {
+                    shell_error(sh, "Kombinasyon calistirilamadi: %d", err);
+                    break;
+                }
+
+                format_rate(rate, sizeof(rate), bench_rates[r]);
+                shell_print(sh, "%-9s %3u %5u %4u.%u%% %7s %7s %7s %7s %12u.%u", rate,
+                            bench_watermarks[w], bench_thresh_mg[t], rep.sleep_permille / 10U,
+                            rep.sleep_permille % 10U,
+                            format_ua(ua[0], sizeof(ua[0]), rep.sensor_na),
+                            format_ua(ua[1], sizeof(ua[1]), rep.bus_na),
+                            format_ua(ua[2], sizeof(ua[2]), rep.cpu_na),
+                            format_ua(ua[3], sizeof(ua[3]), rep.total_na),
+                            rep.life_h / 24U, (rep.life_h % 24U) * 10U / 24U);
+
+                if (rep.life_h > best_life) {
+                    best_life = rep.life_h;
+                    snprintk(best, sizeof(best), "%s Hz, wm %u, %u mg", rate, bench_watermarks[w],
+                             bench_thresh_mg[t]);
+                }
+            }
+        }
+    }
+
+    /* Ayarlari geri yukle */
+    sample_pipeline_stop();
+    adxl345_emul_set_trace_rate(0);
+    adxl345_emul_set_trace(NULL, 0);
+    adxl345_set_bw_rate(saved.bw_rate);
+    adxl345_set_thresh_act(saved.thresh_act);
+    adxl345_set_thresh_inact(saved.thresh_inact);
+    adxl345_update_reg(ADXL345_POWER_CTL, ADXL_POWER_CTL_MEASURE, ADXL_POWER_CTL_MEASURE);
+    energy_reset();
+
+    if (!err && best_life) {
+        shell_print(sh, "en uzun omur: %s (%u gun)", best, best_life / 24U);
+    }
+    return err;
+}
+#endif
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_energy,
+    SHELL_CMD_ARG(show,  NULL, "Son reset'ten beri ortalama akim, pil omru, durum sureleri", cmd_energy_show,  1, 0),
+    SHELL_CMD_ARG(reset, NULL, "Olcum araligini yeniden baslat",                           cmd_energy_reset, 1, 0),
+    SHELL_CMD_ARG(model, NULL, "Akim modeli",                                              cmd_energy_model, 1, 0),
+    SHELL_CMD_ARG(set,   NULL, "Model degeri: set <alan> <deger>",                         cmd_energy_set,   3, 0),
+#if defined(CONFIG_EMUL)
+    SHELL_CMD_ARG(bench, NULL, "Ayar izgarasi icin pil omru (native_sim): bench [sn]",    cmd_energy_bench, 1, 1),
+#endif
+    SHELL_SUBCMD_SET_END
+);
+
+SHELL_SUBCMD_ADD((adxl), energy, &sub_energy, "Enerji modeli ve pil omru tahmini", NULL, 0, 0);
+#endif
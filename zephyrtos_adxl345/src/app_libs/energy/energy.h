@@ -0,0 +1,84 @@
+/**
+ * @file energy.h
+ * @brief Enerji modeli ve pil omru tahmini
+ *
+ * Surucunun calisma anindaki guc durumu sureleri (adxl345_get_residency) ve
+ * hat/uyanma sayaclari bir akim modeli ile ortalama akima, oradan pil omrune
+ * cevrilir. Uc bilesen ayri hesaplanir:
+ *
+ *   sensor : durum basina sure x ADXL345 akimi (ODR ve LOW_POWER bitine gore,
+ *            datasheet Tablo 7/8, VS = 2.5 V), uyku ve standby
+ *   hat    : hatta gecen bit / hat frekansi x hat cevre birimi akimi
+ *   CPU    : (hat suresi + uyanma basina ve ornek basina is) x aktif akim,
+ *            kalan sure x bosta akim
+ *
+ * Model degerleri bir kart icin tahmindir ve calisma aninda degistirilebilir
+ * (`adxl energy set`). native_sim'de `adxl energy bench`, ayni hareket izi
+ * uzerinde BW_RATE, FIFO watermark ve esik kombinasyonlarini calistirip
+ * her biri icin tahmini pil omrunu raporlar.
+ */
+#ifndef ENERGY_H
+#define ENERGY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "adxl345.h"
+
+/** @brief Varsayilan model degerleri (CR2032, nRF52 sinifi MCU, 3 V) */
+#define ENERGY_DEFAULT_BATTERY_MAH      225
+#define ENERGY_DEFAULT_ADXL_SLEEP_NA    23000   /*!< Auto-sleep, README'deki deger */
+#define ENERGY_DEFAULT_ADXL_STANDBY_NA  100
+#define ENERGY_DEFAULT_BUS_ACTIVE_NA    500000
+#define ENERGY_DEFAULT_CPU_ACTIVE_NA    3300000
+#define ENERGY_DEFAULT_CPU_IDLE_NA      3000
+#define ENERGY_DEFAULT_CPU_WAKE_US      30      /*!< Interrupt, thread gecisi, k_poll */
+#define ENERGY_DEFAULT_CPU_SAMPLE_NS    10000   /*!< Listener'larda ornek basina is   */
+
+/** @brief Akim modeli; akimlar nA cinsindendir */
+struct energy_model {
+    uint32_t battery_mah;       /*!< Pil kapasitesi                             */
+    uint32_t adxl_sleep_na;     /*!< Sensor uykuda                              */
+    uint32_t adxl_standby_na;   /*!< Sensor standby                             */
+    uint32_t bus_active_na;     /*!< Hat (SPI/I2C) cevre birimi, aktarim sirasinda */
+    uint32_t cpu_active_na;     /*!< CPU calisirken                             */
+    uint32_t cpu_idle_na;       /*!< CPU uykuda (RTC acik)                      */
+    uint32_t cpu_wake_us;       /*!< Interrupt basina CPU suresi                */
+    uint32_t cpu_sample_ns;     /*!< Islenen ornek basina CPU suresi            */
+};
+
+/** @brief Bir olcum araliginda biriken sayaclar */
+struct energy_counters {
+    uint64_t wire_bits;         /*!< Hatta gecen bit                            */
+    uint32_t transfers;         /*!< Hat islemi (okuma + yazma)                 */
+    uint32_t wakeups;           /*!< ADXL345 interrupt'u (MCU uyanmasi)         */
+    uint32_t samples;           /*!< Yayinlanan FIFO ornegi                     */
+};
+
+/** @brief Tahmin sonucu; akimlar aralik ortalamasidir (nA) */
+struct energy_report {
+    uint64_t elapsed_us;        /*!< Olcum araligi                              */
+    uint64_t bus_us;            /*!< Hat aktarim suresi                         */
+    uint64_t cpu_active_us;     /*!< CPU aktif suresi                           */
+    uint32_t sleep_permille;    /*!< Sensorun uyku/standby'da gecirdigi oran    */
+    uint32_t sensor_na;
+    uint32_t bus_na;
+    uint32_t cpu_na;
+    uint32_t total_na;
+    uint32_t life_h;            /*!< Tahmini pil omru (saat)                    */
+    struct energy_counters counters;
+};
+
+public uint32_t energy_adxl_current_na(const struct energy_model *model, uint8_t pstate);
+public void energy_estimate(const struct energy_model *model, const struct adxl345_residency *res,
+                            const struct energy_counters *counters, struct energy_report *out);
+public void energy_get_model(struct energy_model *model);
+public void energy_reset(void);
+public void energy_measure(struct energy_report *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ENERGY_H
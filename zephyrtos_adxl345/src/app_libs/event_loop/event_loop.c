@@ -0,0 +1,108 @@
+#include "event_loop.h"
+#include "sample_pipeline.h"
+#include "impact.h"
+#include "adxl345_motion_example.h"
+#include "utils.h"
+#include <zephyr/kernel.h>
+
+LOG_MODULE_REGISTER(event_loop, LOG_LEVEL_INF);
+
+
+extern struct k_sem adxl_data_semaphore;
+extern struct k_sem adxl_int_semaphore;
+extern struct k_sem motion_semaphore;
+#if defined(CONFIG_APP_IMPACT)
+extern struct k_sem impact_semaphore;
+#endif
+
+/** @brief Beklenen olaylar; sira isleme onceligini belirler */
+enum {
+    EVENT_ADXL_DATA = 0,
+#if defined(CONFIG_APP_IMPACT)
+    EVENT_IMPACT,
+#endif
+    EVENT_ADXL_INT,
+    EVENT_MOTION,
+    EVENT_COUNT,
+};
+
+static struct k_poll_event events[EVENT_COUNT] = {
+    K_POLL_EVENT_STATIC_INITIALIZER(K_POLL_TYPE_SEM_AVAILABLE, K_POLL_MODE_NOTIFY_ONLY, &adxl_data_semaphore, 0),
+#if defined(CONFIG_APP_IMPACT)
+    K_POLL_EVENT_STATIC_INITIALIZER(K_POLL_TYPE_SEM_AVAILABLE, K_POLL_MODE_NOTIFY_ONLY, &impact_semaphore, 0),
+#endif
+    K_POLL_EVENT_STATIC_INITIALIZER(K_POLL_TYPE_SEM_AVAILABLE, K_POLL_MODE_NOTIFY_ONLY, &adxl_int_semaphore, 0),
+    K_POLL_EVENT_STATIC_INITIALIZER(K_POLL_TYPE_SEM_AVAILABLE, K_POLL_MODE_NOTIFY_ONLY, &motion_semaphore, 0),
+};
+
+
+/**
+ * @brief Hazir olan olaylarin semaforlarini alir ve isleyicilerini cagirir.
+ *
+ * Veri pini servisi (FIFO bosaltma) zamana en duyarli is oldugu icin ilk
+ * calisir; darbe kaydi toplamasi da FIFO dolmadan okumak zorunda oldugundan
+ * onu izler. Ardindan olay pini servisi gelir. Hareket olayi cogunlukla olay
+ * servisi icinde verilir ve ayni turda islenir.
+ */
+private void dispatch_events(void)
+{
+    if (events[EVENT_ADXL_DATA].state == K_POLL_STATE_SEM_AVAILABLE &&
+        k_sem_take(&adxl_data_semaphore, K_NO_WAIT) == 0) {
+        sample_pipeline_service_data();
+    }
+
+#if defined(CONFIG_APP_IMPACT)
+    if (events[EVENT_IMPACT].state == K_POLL_STATE_SEM_AVAILABLE &&
+        k_sem_take(&impact_semaphore, K_NO_WAIT) == 0) {
+        impact_service();
+    }
+#endif
+
+    if (events[EVENT_ADXL_INT].state == K_POLL_STATE_SEM_AVAILABLE &&
+        k_sem_take(&adxl_int_semaphore, K_NO_WAIT) == 0) {
+        sample_pipeline_service();
+    }
+
+    if (k_sem_take(&motion_semaphore, K_NO_WAIT) == 0) {
+        motion_event_handler();
+    }
+
+    for (int i = 0; i < EVENT_COUNT; i++) {
+        events[i].state = K_POLL_STATE_NOT_READY;
+    }
+}
+
+/**
+ * @brief Uygulama olaylarini bekleyen tek thread.
+ *
+ * Interrupt handler'lar yalnizca semafor verir; SPI erisimi ve tum
+ * olay isleme bu thread'de sirayla yapilir.
+ */
+void event_loop_thread(void *vp1, void *vp2, void *vp3)
+{
+    ARG_UNUSED(vp1);
+    ARG_UNUSED(vp2);
+    ARG_UNUSED(vp3);
+
+    while (1) {
+        int err = k_poll(events, EVENT_COUNT, K_FOREVER);
+
+        if (err) {
+            LOG_ERROR("[%s]: k_poll hatasi: %d", __func__, err);
+            continue;
+        }
+        dispatch_events();
+    }
+}
+
+K_THREAD_DEFINE(
+    event_loop_thread_id,
+    EVENT_LOOP_STACK_SIZE,
+    event_loop_thread,
+    NULL,                        // vp1
+    NULL,                        // vp2
+    NULL,                        // vp3
+    EVENT_LOOP_PRIORITY,
+    0,
+    0
+);
@@ -0,0 +1,35 @@
+/**
+ * @file event_loop.h
+ * @brief Uygulamanin tek bekleme thread'i
+ *
+ * Yalnizca semafor bekleyen thread'ler (interrupt servisi, hareket olayi)
+ * tek bir k_poll dongusunde birlestirilmistir; her bekleyen is icin ayri
+ * yigin ve thread nesnesi ayrilmaz. Yeni bir bekleme kaynagi eklemek icin
+ * event_loop.c'deki olay tablosuna bir satir ve isleyici eklenir.
+ *
+ * @author uzunberkay
+ */
+#ifndef EVENT_LOOP_H
+#define EVENT_LOOP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Event loop yigin boyutu.
+ * Pipeline ve olay kanali listener'lari (ic ice yayinlar dahil) bu thread'de
+ * calisir. En kotu durum derinligi her derlemede cagri grafiginden hesaplanir
+ * ve footprint_budget hedefinde bu degerle karsilastirilir (CMakeLists.txt bu
+ * satiri okur).
+ */
+#define EVENT_LOOP_STACK_SIZE       1024
+
+/** @brief Event loop onceligi */
+#define EVENT_LOOP_PRIORITY         4
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EVENT_LOOP_H
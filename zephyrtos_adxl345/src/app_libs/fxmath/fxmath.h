@@ -0,0 +1,123 @@
+/**
+ * @file fxmath.h
+ * @brief Sabit noktali (tamsayi) matematik yardimcilari
+ *
+ * libm ve kayan nokta birimi gerektirmeyen, sure ve hata sinirlari bilinen
+ * yardimci fonksiyonlar. Sensor ornek islemede ortak kullanilir.
+ */
+#ifndef FXMATH_H
+#define FXMATH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/**
+ * @brief 32 bit tamsayi karekoku (asagi yuvarlanmis).
+ *
+ * Bit bit (digit-by-digit) yontem; en fazla 16 tur, carpma ve bolme kullanmaz.
+ *
+ * @param value Karekoku alinacak deger.
+ * @return floor(sqrt(value)).
+ */
+static inline uint32_t fx_isqrt32(uint32_t value)
+{
+    uint32_t result = 0;
+    uint32_t bit = 1UL << 30;
+
+    while (bit > value) {
+        bit >>= 2;
+    }
+
+    while (bit != 0) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return result;
+}
+
+/**
+ * @brief Uc eksenli vektorun buyuklugu (mg cinsinden girisler icin).
+ *
+ * Eksenler ±16 g (±16000 mg) sinirinda oldugundan karelerin toplami 32 bit'e sigar.
+ */
+static inline uint32_t fx_magnitude3(int32_t x, int32_t y, int32_t z)
+{
+    return fx_isqrt32((uint32_t)(x * x) + (uint32_t)(y * y) + (uint32_t)(z * z));
+}
+
+/**
+ * @brief Sinus yaklasimi (Bhaskara I), Q15 cikis.
+ *
+ * sin(x) ~ 16x(pi - x) / (5pi^2 - 4x(pi - x)), en buyuk mutlak hata ~0.0016.
+ *
+ * @param angle Aci; 0..65535 araligi 0..2pi'ye karsilik gelir.
+ * @return sin(angle) * 32767.
+ */
+static inline int16_t fx_sin_q15(uint16_t angle)
+{
+    const int32_t half = 32768;
+    int32_t a = angle & (half - 1);
+    int32_t p = (a * (half - a)) >> 15;             /* x(pi - x), pi = 32768 olceginde */
+    int32_t s = (4 * p * 32767) / (5 * 8192 - p);   /* 16p / (5pi^2 - 4p), 32 bit'e sigacak sekilde */
+
+    return (int16_t)((angle & half) ? -s : s);
+}
+
+/**
+ * @brief [0, 1] araligindaki oran icin arktanjant (santiderece).
+ *
+ * atan(z) ~ pi/4 z + z(1 - z)(0.2447 + 0.0663 z); en buyuk hata ~0.09 derece.
+ *
+ * @param z Oran (Q15, 0..32768).
+ * @return atan(z), 0..4500 santiderece.
+ */
+static inline int32_t fx_atan_unit_cdeg(int32_t z)
+{
+    int32_t curve = (z * (32768 - z)) >> 15;
+    int32_t coeff = 1402 + ((380 * z) >> 15);
+
+    return (4500 * z + curve * coeff + (1 << 14)) >> 15;
+}
+
+/**
+ * @brief Dort bolgeli arktanjant (santiderece).
+ *
+ * Oran her zaman kucuk bilesenin buyuge bolunmesiyle [0, 1] araligina
+ * indirgenir; bolge ve isaret sonradan eklenir. Tek bolme, libm gerekmez.
+ *
+ * @param y, x Girisler; |y|, |x| < 65536 olmalidir.
+ * @return atan2(y, x), -18000..18000 santiderece.
+ */
+static inline int32_t fx_atan2_cdeg(int32_t y, int32_t x)
+{
+    uint32_t ax = (x < 0) ? -x : x;
+    uint32_t ay = (y < 0) ? -y : y;
+    int32_t angle;
+
+    if (ax == 0 && ay == 0) {
+        return 0;
+    }
+    if (ay <= ax) {
+        angle = fx_atan_unit_cdeg((int32_t)((ay << 15) / ax));
+    } else {
+        angle = 9000 - fx_atan_unit_cdeg((int32_t)((ax << 15) / ay));
+    }
+    if (x < 0) {
+        angle = 18000 - angle;
+    }
+    return (y < 0) ? -angle : angle;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FXMATH_H
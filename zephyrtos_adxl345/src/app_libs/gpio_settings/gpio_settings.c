@@ -5,20 +5,34 @@
 
 LOG_MODULE_REGISTER(gpio_settings, LOG_LEVEL_DBG);
 K_SEM_DEFINE(motion_semaphore,0,1);
+K_SEM_DEFINE(adxl_int_semaphore,0,1);
+K_SEM_DEFINE(adxl_data_semaphore,0,1);
 
 
 const struct gpio_dt_spec errled = GPIO_DT_SPEC_GET(ERROR_LED, gpios);
-const struct gpio_dt_spec adxl345_interrupt_pin = GPIO_DT_SPEC_GET(ADXL_INT_PIN, gpios);
+const struct gpio_dt_spec adxl345_interrupt_pin = GPIO_DT_SPEC_GET(ADXL_INT_EVENT_NODE, gpios);
 
 struct gpio_callback adxl345_interrupt_callback;
-struct spi_dt_spec* spi_device;
+const struct adxl345_bus* sensor_bus;
+
+/** @brief Pin basina interrupt sayaclari (olay/tek pin, veri pini) */
+static atomic_t event_irq_count;
+
+#if ADXL_INT_SPLIT
+const struct gpio_dt_spec adxl345_data_pin = GPIO_DT_SPEC_GET(ADXL_INT_DATA_NODE, gpios);
+struct gpio_callback adxl345_data_callback;
+static atomic_t data_irq_count;
+#endif
 
 
 
 typedef void(*gpio_callback_handler)(const struct device*,struct gpio_callback*,uint32_t);
 
 private void adxl345_interrupt_handler(const struct device *dev, struct gpio_callback *cb, uint32_t pins);
-private void init_spi_device(void);
+#if ADXL_INT_SPLIT
+private void adxl345_data_handler(const struct device *dev, struct gpio_callback *cb, uint32_t pins);
+#endif
+private void init_sensor_bus(void);
 private gpio_status_t configure_interrupt(  const struct gpio_dt_spec*      GPIOx , 
                                             gpio_flags_t                    interrupt_type , 
                                             struct gpio_callback*           callback_config ,
@@ -156,22 +170,21 @@ private gpio_status_t configure_interrupt(  const struct gpio_dt_spec*
 }   
 
 /**
- * @brief SPI cihazını başlatır ve global `spi_device` değişkenini yapılandırır.
+ * @brief Sensor hattini alir ve global `sensor_bus` değişkenini yapılandırır.
  * 
- * Bu fonksiyon, global olarak tanımlanan `spi_device` değişkenini başlatmak için 
+ * Bu fonksiyon, global olarak tanımlanan `sensor_bus` değişkenini başlatmak için 
  * kullanılır. Global değişkenin doğrudan başlatılması sırasında derleyici, 
  * sabit olmayan tanımlamalar nedeniyle hata verebilir. Bu nedenle başlatma işlemi 
  * burada yapılır.
  *
- * @note  `get_spi_device()` fonksiyonu kullanılarak SPI cihazı alınır ve 
- *        `spi_device` işaretçisine atanır. SPI cihazı, ADXL345 gibi donanımlarla 
- *        iletişim kurmak için kullanılır.
+ * @note  `adxl345_get_bus()` fonksiyonu kullanılarak sensor hattı (SPI veya I2C,
+ *        devicetree'ye göre) alınır ve `sensor_bus` işaretçisine atanır.
  *
  * @return void Döndürülen bir değer yoktur.
  */
-private void init_spi_device(void)
+private void init_sensor_bus(void)
 {
-    spi_device = get_spi_device();
+    sensor_bus = adxl345_get_bus();
 }
 
 
@@ -180,8 +193,9 @@ private void init_spi_device(void)
  * 
  * Bu fonksiyon, GPIO modulu icin temel konfigurasyonlari yapar.
  * - Belirtilen GPIO LED pini konfigure edilir.
- * - ADXL345 icin interrupt (kesme) yapılandırması yapılır.
- * - SPI cihaz baslatilir.
+ * - ADXL345 icin interrupt (kesme) yapılandırması yapılır; INT1 devicetree'de
+ *   tanimliysa veri pini ayrica yapilandirilir.
+ * - Sensor hatti alinir.
  *
  * GPIO pini ve kesme konfigürasyonu sirasinda herhangi bir hata
  * meydana gelirse uygun hata kodlari ile geri donus yapar.
@@ -222,7 +236,21 @@ private gpio_status_t init_gpio(const struct device *dev)
     }
     LOG_INFO("[%s]: ADXL345 kesme konfigurasyonu basariyla tamamlandi.", __func__);
 
-    init_spi_device();
+#if ADXL_INT_SPLIT
+    ret = configure_interrupt(  &adxl345_data_pin,
+                                GPIO_INT_EDGE_TO_ACTIVE,
+                                &adxl345_data_callback,
+                                adxl345_data_handler);
+    if(ret != GPIO_SUCCESS )
+    {
+        LOG_ERROR("[%s]: ADXL345 veri pini kesme konfigurasyonu basarisiz! Hata Kodu: %d", __func__, ret);
+        return ret;
+    }
+    LOG_INFO("[%s]: Veri kaynaklari INT%d, olay kaynaklari INT%d pinine eslendi.", __func__,
+                CONFIG_ADXL_INT_DATA_PIN, 3 - CONFIG_ADXL_INT_DATA_PIN);
+#endif
+
+    init_sensor_bus();
     LOG_INFO("[%s]: GPIO konfigurasyonu basariyla tamamlandi.", __func__);
     return GPIO_SUCCESS; 
 }
@@ -235,9 +263,9 @@ SYS_INIT(init_gpio, APPLICATION, GPIO_INIT_PRIORITY);
  * @brief  ADXL345 sensöründen gelen interrupt'u (kesmeyi) isler.
  * 
  * Bu fonksiyon, ADXL345'ten gelen bir interrupt (kesme) tetiklendikten sonra
- * çağrılır. SPI üzerinden ADXL345'in INT_SOURCE register'ini okuyarak
- * hangi kesmenin (aktivite/inaktivite) tetiklendiğini tespit eder. Aktivite
- * veya inaktivite durumuna göre belirli islemler yapilir (örnegin, LED yakma/söndürme).
+ * çağrılır. Hat (SPI/I2C) islemleri interrupt baglaminda beklemeye yol actigi icin burada
+ * INT_SOURCE okunmaz; yalnizca `adxl_int_semaphore` verilir. Register okuma ve
+ * olaylarin ayrilmasi event loop thread'inde yapilir.
  *
  * @param[in] dev   Interrupt'a sebep olan cihaz (cihaz bilgisi).
  * @param[in] cb    Interrupt callback yapilandirmasi.
@@ -247,21 +275,109 @@ SYS_INIT(init_gpio, APPLICATION, GPIO_INIT_PRIORITY);
  */
 private void adxl345_interrupt_handler(const struct device *dev , struct gpio_callback *cb , uint32_t pins)
 {
+    LOG_DEBUG("[%s]: ADXL345 interrupt algilandi! Pins: 0x%x", __func__, pins);
 
-   
-    static uint8_t data[1];
-    
-    volatile int ret;
+    atomic_inc(&event_irq_count);
+    k_sem_give(&adxl_int_semaphore);
+}
 
-    LOG_DEBUG("[%s]: ADXL345 interrupt algilandi! Pins: 0x%x", __func__, pins);
-   
-    
-    
-    ret = spi_read_reg(spi_device , ADXL345_INT_SOURCE , data , 1);
+#if ADXL_INT_SPLIT
+/**
+ * @brief  ADXL345 veri pininden (DATA_READY, WATERMARK, OVERRUN) gelen interrupt'u isler.
+ *
+ * Bu pine yalnizca veri kaynaklari eslendigi icin kaynak bellidir; event loop
+ * INT_SOURCE okumadan dogrudan FIFO'yu bosaltir. Yalnizca `adxl_data_semaphore`
+ * verilir.
+ *
+ * @param[in] dev   Interrupt'a sebep olan cihaz (cihaz bilgisi).
+ * @param[in] cb    Interrupt callback yapilandirmasi.
+ * @param[in] pins  Hangi pinin kesme olusturdugu bilgisi.
+ */
+private void adxl345_data_handler(const struct device *dev , struct gpio_callback *cb , uint32_t pins)
+{
+    ARG_UNUSED(dev);
+    ARG_UNUSED(cb);
+    ARG_UNUSED(pins);
 
-    LOG_INFO("[%s]: INT_SOURCE: 0x%x", __func__, data[0]);
+    atomic_inc(&data_irq_count);
+    k_sem_give(&adxl_data_semaphore);
+}
+#endif
 
-    if( data[0] & ADXL345_ACT_INTERRUPT_MASK )   // aktivite algilandi ! 
+/**
+ * @brief  Veri pininin seviyesini okur (hat erisimi yapilmaz).
+ *
+ * Pin kenar tetiklemeli oldugu icin FIFO bosaltilirken watermark'in yeniden
+ * asilmasi yeni bir kenar uretmez; bosaltma sonrasi pin hala aktifse FIFO
+ * yeniden okunmalidir. Bu kontrol INT_SOURCE okumasinin yerini alir.
+ *
+ * @return Pin aktifse true; ayri veri pini yoksa veya okunamazsa false.
+ */
+public bool adxl_data_pin_active(void)
+{
+#if ADXL_INT_SPLIT
+    return gpio_pin_get_dt(&adxl345_data_pin) > 0;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief  Olay pininin (tek pinli yapilandirmada tek pinin) seviyesini okur.
+ *
+ * Servis sonrasi pin hala aktifse kaynak servis sirasinda yeniden olusmustur
+ * ve kenar tetiklemeli pin yeni interrupt uretmez.
+ *
+ * @return Pin aktifse true; okunamazsa false.
+ */
+public bool adxl_event_pin_active(void)
+{
+    return gpio_pin_get_dt(&adxl345_interrupt_pin) > 0;
+}
+
+/**
+ * @brief  ADXL345 pinlerinden gelen toplam interrupt sayisi (MCU uyanma sayisi).
+ */
+public uint32_t adxl_irq_count(void)
+{
+#if ADXL_INT_SPLIT
+    return (uint32_t)atomic_get(&event_irq_count) + (uint32_t)atomic_get(&data_irq_count);
+#else
+    return (uint32_t)atomic_get(&event_irq_count);
+#endif
+}
+
+/**
+ * @brief  ADXL345 INT_SOURCE register'ini okur.
+ *
+ * Okuma, aktivite/inaktivite gibi kilitlenen (latched) interrupt bitlerini temizler.
+ *
+ * @param[out] source   Okunan INT_SOURCE degeri.
+ * @return Basariliysa 0, aksi halde hata kodu.
+ */
+public int read_interrupt_source(uint8_t *source)
+{
+    int ret = adxl345_read_reg(sensor_bus , ADXL345_INT_SOURCE , source , 1);
+
+    if (ret) {
+        LOG_ERROR("[%s]: INT_SOURCE okunamadi! Hata Kodu: %d", __func__, ret);
+        return ret;
+    }
+    LOG_DEBUG("[%s]: INT_SOURCE: 0x%x", __func__, *source);
+    return 0;
+}
+
+/**
+ * @brief  INT_SOURCE degerindeki aktivite/inaktivite olaylarini isler.
+ *
+ * Aktivite veya inaktivite durumuna göre belirli islemler yapilir
+ * (örnegin, LED yakma/söndürme).
+ *
+ * @param[in] source    INT_SOURCE register degeri.
+ */
+public void handle_motion_event(uint8_t source)
+{
+    if( source & ADXL345_ACT_INTERRUPT_MASK )   // aktivite algilandi ! 
     {
         /*
             Sensor hareket algiladiginda buradaki islemleri yapar
@@ -273,7 +389,7 @@ private void adxl345_interrupt_handler(const struct device *dev , struct gpio_ca
        k_sem_give(&motion_semaphore);
 
     } 
-    else if( data[0] & ADXL345_INACT_INTERRUPT_MASK ) //inaktivite algilandi ! 
+    else if( source & ADXL345_INACT_INTERRUPT_MASK ) //inaktivite algilandi ! 
     {
 
         /*
@@ -285,10 +401,6 @@ private void adxl345_interrupt_handler(const struct device *dev , struct gpio_ca
      
 
     }
-    else{return ;}
-
-    
-
 }
 
 
@@ -316,3 +428,27 @@ public const struct gpio_dt_spec* get_gpio_led(void)
 {
     return &errled;
 }
+
+
+#if defined(CONFIG_SHELL)
+#include <zephyr/shell/shell.h>
+
+private int cmd_irq_show(const struct shell *sh, size_t argc, char **argv)
+{
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+#if ADXL_INT_SPLIT
+    shell_print(sh, "yonlendirme : veri INT%d, olay INT%d (INT_MAP 0x%02X)",
+                CONFIG_ADXL_INT_DATA_PIN, 3 - CONFIG_ADXL_INT_DATA_PIN, ADXL_INT_MAP_ROUTE);
+    shell_print(sh, "veri pini   : %ld kesme", (long)atomic_get(&data_irq_count));
+    shell_print(sh, "olay pini   : %ld kesme", (long)atomic_get(&event_irq_count));
+#else
+    shell_print(sh, "yonlendirme : tek pin, tum kaynaklar INT2 (INT_SOURCE ile ayrilir)");
+    shell_print(sh, "INT2        : %ld kesme", (long)atomic_get(&event_irq_count));
+#endif
+    return 0;
+}
+
+SHELL_SUBCMD_ADD((adxl), irq, NULL, "INT1/INT2 yonlendirmesi ve kesme sayaclari", cmd_irq_show, 1, 0);
+#endif
@@ -34,10 +34,52 @@ typedef enum {
 #define GPIO_INIT_PRIORITY 41
 
 
-#define ADXL_INT_PIN         DT_ALIAS(adxl_select)
+#define ADXL_INT1_PIN        DT_ALIAS(adxl_int1)
+#define ADXL_INT2_PIN        DT_ALIAS(adxl_select)
 #define ERROR_LED            DT_ALIAS(error_led)
 
+/**
+ * @brief Yuksek hizli (veri) interrupt kaynaklari: veri pinine eslenir.
+ *
+ * Diger kaynaklar (aktivite, inaktivite, tap, serbest dusme) olay pinine eslenir.
+ */
+#define ADXL_INT_DATA_SOURCES   (ADXL_INT_MAP_DATA_READY | ADXL_INT_MAP_WATERMARK | ADXL_INT_MAP_OVERRUN)
+
+/**
+ * @brief Pin yonlendirmesi.
+ *
+ * INT1 devicetree'de tanimliysa veri ve olay kaynaklari ayri pinlere eslenir
+ * (ADXL_INT_SPLIT); veri pini CONFIG_ADXL_INT_DATA_PIN ile secilir. Tanimli
+ * degilse tum kaynaklar INT2'ye eslenir ve kaynaklar INT_SOURCE okunarak ayrilir.
+ *
+ * ADXL_INT_MAP_ROUTE, INT_MAP register'inin tum kaynaklar icin degeridir
+ * (bit 1: INT2, bit 0: INT1). impact modulu FIFO trigger pinini (FIFO_CTL
+ * TRIGGER biti) aktivite kaynaginin buradaki yerinden turetir; aktivite
+ * baska bir pine tasinirsa darbe kaydi da o pini izler.
+ */
+#if DT_NODE_EXISTS(ADXL_INT1_PIN)
+#define ADXL_INT_SPLIT          1
+#if CONFIG_ADXL_INT_DATA_PIN == 1
+#define ADXL_INT_DATA_NODE      ADXL_INT1_PIN
+#define ADXL_INT_EVENT_NODE     ADXL_INT2_PIN
+#define ADXL_INT_MAP_ROUTE      ((uint8_t)~ADXL_INT_DATA_SOURCES)
+#else
+#define ADXL_INT_DATA_NODE      ADXL_INT2_PIN
+#define ADXL_INT_EVENT_NODE     ADXL_INT1_PIN
+#define ADXL_INT_MAP_ROUTE      ((uint8_t)ADXL_INT_DATA_SOURCES)
+#endif
+#else
+#define ADXL_INT_SPLIT          0
+#define ADXL_INT_EVENT_NODE     ADXL_INT2_PIN
+#define ADXL_INT_MAP_ROUTE      ((uint8_t)0xFF)
+#endif
+
 public const struct gpio_dt_spec* get_gpio_led(void);
+public int read_interrupt_source(uint8_t *source);
+public void handle_motion_event(uint8_t source);
+public bool adxl_data_pin_active(void);
+public bool adxl_event_pin_active(void);
+public uint32_t adxl_irq_count(void);
 
 
 
@@ -0,0 +1,564 @@
+#include "impact.h"
+#include "sample_pipeline.h"
+#include "spi_bus.h"
+#include "gpio_settings.h"
+#include "fxmath.h"
+#include "utils.h"
+#include <string.h>
+#include <zephyr/kernel.h>
+
+LOG_MODULE_REGISTER(impact, LOG_LEVEL_INF);
+
+ZBUS_CHAN_DEFINE(impact_chan,
+                 struct impact_record,
+                 NULL,
+                 NULL,
+                 ZBUS_OBSERVERS_EMPTY,
+                 ZBUS_MSG_INIT(0));
+
+/** @brief Tetikleme ile FIFO okuma arasinda beklenmesi gereken en kisa sure (datasheet: 5 µs) */
+#define IMPACT_TRIGGER_SETTLE_US    5
+
+/**
+ * @brief FIFO trigger girisi: aktivite interrupt'unun INT_MAP'te eslendigi pin.
+ * Trigger olayi FIFO_CTL'de secilen pine eslenen kaynaklardan gelir; bu yuzden
+ * yonlendirme gpio_settings.h'taki ADXL_INT_MAP_ROUTE'tan turetilir.
+ */
+#define IMPACT_FIFO_TRIGGER         ((ADXL_INT_MAP_ROUTE & ADXL_INT_MAP_ACTIVITY) ? ADXL_FIFO_CTL_TRIGGER_INT2 : 0)
+
+/** @brief Kurulum sirasinda degistirilen ve kaldirilinca geri yuklenen ayarlar */
+struct impact_saved {
+    struct adxl345_config config;
+    uint8_t act_inact_ctl;
+    uint8_t power_ctl;
+};
+
+/*
+ * Son okuma 32 ornegin tamamini donebilir; fazlasi kayda alinmaz ama tampon
+ * tasmamalidir. Boylece tam dolu FIFO (ornek kaybi) tek okumada anlasilir.
+ */
+static struct adxl345_sample record_buf[IMPACT_MAX_SAMPLES + ADXL345_FIFO_DEPTH - 1];
+
+/*
+ * Kurulum ve toplama durumu impact_lock ile korunur: arm/disarm shell
+ * thread'inde, toplama event loop'ta calisir. Kilit sirasi: impact_lock,
+ * ardindan surucunun ayar kilidi ve hat. Listener kilidi almaz; yalnizca
+ * event loop thread'inde degisen `trigger_pending`'i kurar.
+ */
+K_MUTEX_DEFINE(impact_lock);
+
+static bool armed;
+static uint8_t arm_bw_rate;
+static uint8_t arm_pre;
+static uint16_t arm_post;
+static uint16_t arm_thresh_mg;
+static struct impact_saved saved;
+
+static uint32_t arm_step_us;
+
+/* Listener'in kurdugu tetikleme istegi; listener ve impact_service ayni (event loop) thread'dedir */
+static bool trigger_pending;
+static uint32_t trigger_ms;
+
+static bool capturing;
+static bool capture_lost;
+static uint16_t capture_count;
+static int capture_stalled;
+static uint32_t capture_ms;
+
+K_SEM_DEFINE(impact_semaphore, 0, 1);
+
+private void impact_timer_handler( struct k_timer *timer )
+{
+    ARG_UNUSED(timer);
+    k_sem_give(&impact_semaphore);
+}
+
+K_TIMER_DEFINE(impact_timer, impact_timer_handler, NULL);
+
+static uint32_t record_seq;
+static uint32_t last_capture_ms;
+static struct impact_record last_record;
+static struct k_spinlock last_lock;
+
+
+/**
+ * @brief Bir kaydin tepe ivmesini ve suresini hesaplar.
+ *
+ * On-tetikleme orneklerinin ortalamasi (yercekimi ve durus egimi) her ornekten
+ * cikarilir; kalan vektorun buyuklugu tepe ve sure icin kullanilir. Sure,
+ * buyuklugu `thresh_mg`'yi asan ilk ve son ornek arasidir. On-tetikleme ornegi
+ * yoksa ilk ornek referans alinir.
+ *
+ * @param record    samples, count, trigger_index ve bw_rate dolu kayit; sonuc alanlari yazilir.
+ * @param thresh_mg Sure esigi (mg).
+ */
+public void impact_analyze(struct impact_record *record, uint16_t thresh_mg)
+{
+    int32_t base[3] = { 0 };
+    uint16_t ref = MAX(record->trigger_index, 1);
+    int first = -1, last = -1;
+
+    record->peak_mg = 0;
+    record->peak_index = 0;
+    record->duration_us = 0;
+    if (record->count == 0) {
+        return;
+    }
+
+    for (int i = 0; i < ref; i++) {
+        base[0] += record->samples[i].x;
+        base[1] += record->samples[i].y;
+        base[2] += record->samples[i].z;
+    }
+    for (int a = 0; a < 3; a++) {
+        base[a] /= ref;
+    }
+
+    for (int i = 0; i < record->count; i++) {
+        const struct adxl345_sample *s = &record->samples[i];
+        uint32_t mag = fx_magnitude3(adxl345_lsb_to_mg(s->x - base[0], 0),
+                                     adxl345_lsb_to_mg(s->y - base[1], 0),
+                                     adxl345_lsb_to_mg(s->z - base[2], 0));
+
+        if (mag > record->peak_mg) {
+            record->peak_mg = (uint16_t)MIN(mag, UINT16_MAX);
+            record->peak_index = i;
+        }
+        if (mag > thresh_mg) {
+            first = (first < 0) ? i : first;
+            last = i;
+        }
+    }
+
+    if (first >= 0) {
+        record->duration_us = (uint32_t)(((uint64_t)(last - first + 1) * 1000000000ULL) /
+                                         adxl345_odr_mhz(record->bw_rate));
+    }
+}
+
+/**
+ * @brief FIFO'yu bypass uzerinden yeniden trigger moduna alir; yeni tetiklemeye hazirlar.
+ */
+private int rearm( void )
+{
+    int err = adxl345_fifo_configure(ADXL_FIFO_CTL_MODE_BYPASS);
+
+    if (!err) {
+        err = adxl345_fifo_configure(ADXL_FIFO_CTL_MODE_TRIGGER | IMPACT_FIFO_TRIGGER | arm_pre);
+    }
+    return err;
+}
+
+/**
+ * @brief Toplamayi bitirir: kaydi analiz eder, FIFO'yu yeniden kurar ve yayinlar.
+ *
+ * impact_lock tutulurken ve kurulu iken cagrilir; disarm bu sirada
+ * ayarlari geri yukleyemez, bu yuzden rearm() geri yuklenmis FIFO'yu ezmez.
+ *
+ * @param count Toplanan ornek sayisi veya hata kodu.
+ */
+private void finish_capture( int count )
+{
+    k_timer_stop(&impact_timer);
+    capturing = false;
+
+    if (count <= 0) {
+        LOG_ERROR("[%s]: Darbe kaydi okunamadi! Hata Kodu: %d", __func__, count);
+        rearm();
+        return;
+    }
+
+    struct impact_record record = {
+        .samples        = record_buf,
+        .count          = count,
+        .trigger_index  = MIN(arm_pre, count),
+        .bw_rate        = arm_bw_rate,
+        .lost           = capture_lost,
+        .seq            = record_seq++,
+        .timestamp      = capture_ms,
+    };
+
+    impact_analyze(&record, arm_thresh_mg);
+
+    /* FIFO hemen yeniden kurulur; on-tetikleme tamponu listener'lar calisirken dolar */
+    rearm();
+
+    int err = zbus_chan_pub(&impact_chan, &record, K_MSEC(SAMPLE_PIPELINE_PUB_TIMEOUT_MS));
+    if (err) {
+        LOG_WARNING("[%s]: Kayit yayinlanamadi: %d", __func__, err);
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&last_lock);
+    last_record = record;
+    last_record.samples = NULL;
+    k_spin_unlock(&last_lock, key);
+
+    LOG_INFO("[%s]: Darbe #%u: tepe %u mg, sure %u us%s", __func__, record.seq, record.peak_mg,
+             record.duration_us, record.lost ? " (ornek kaybi)" : "");
+}
+
+/**
+ * @brief Tetikleme istegini isler: hold-off icindeyse FIFO'yu yeniden kurar, degilse toplamayi baslatir.
+ */
+private void start_capture( void )
+{
+    trigger_pending = false;
+    if (record_seq > 0 && trigger_ms - last_capture_ms < IMPACT_HOLDOFF_MS) {
+        k_timer_stop(&impact_timer);
+        rearm();
+        return;
+    }
+
+    capturing = true;
+    capture_lost = false;
+    capture_count = 0;
+    capture_stalled = 0;
+    capture_ms = trigger_ms;
+    last_capture_ms = trigger_ms;
+}
+
+/**
+ * @brief Tetiklenmis FIFO'dan bir parca okur; kayit tamamlaninca yayinlar.
+ *
+ * Event loop'ta impact_semaphore ile calisir; semaforu toplama suresince
+ * yarim FIFO suresi aralikli impact_timer verir. Tetiklemeden sonra FIFO,
+ * FIFO modunda calisir: doluysa yeni ornek almaz; yarim FIFO araligi onu
+ * dolmadan bosaltir. Bir okumada 32 ornek gelmesi FIFO'nun dolup ornek
+ * kacirdigini gosterir. Her okuma RT sinifinda, deadline yarim FIFO suresi
+ * ile yapilir. Okumalar arasinda thread serbesttir; diger olaylar ve
+ * listener'lar toplama boyunca islenir.
+ *
+ * Tum is impact_lock altinda yapilir; kurulum kaldirildiysa zamanlayici
+ * durdurulur ve FIFO'ya dokunulmaz.
+ */
+public void impact_service(void)
+{
+    k_mutex_lock(&impact_lock, K_FOREVER);
+
+    if (!armed) {
+        k_timer_stop(&impact_timer);
+        trigger_pending = false;
+        capturing = false;
+        k_mutex_unlock(&impact_lock);
+        return;
+    }
+    if (trigger_pending) {
+        start_capture();
+    }
+    if (!capturing) {
+        k_mutex_unlock(&impact_lock);
+        return;
+    }
+
+    const struct adxl345_bus *bus = adxl345_get_bus();
+    uint16_t total = arm_pre + arm_post;
+
+    spi_bus_acquire(bus, SPI_BUS_CLASS_RT, arm_step_us);
+    int n = adxl345_read_fifo(&record_buf[capture_count], ADXL345_FIFO_DEPTH);
+    spi_bus_release();
+
+    if (n < 0) {
+        finish_capture(n);
+    } else {
+        if (n == ADXL345_FIFO_DEPTH) {
+            capture_lost = true;
+        }
+
+        capture_count = MIN(capture_count + n, total);
+        capture_stalled = (n == 0) ? capture_stalled + 1 : 0;
+        if (capture_stalled > IMPACT_STALL_STEPS) {
+            capture_lost = true;
+            finish_capture(capture_count);
+        } else if (capture_count >= total) {
+            finish_capture(capture_count);
+        }
+    }
+
+    k_mutex_unlock(&impact_lock);
+}
+
+/**
+ * @brief Aktivite olayinda tetikleme istegi kurar.
+ *
+ * Hat erisimi yapmaz ve kilit almaz; yalnizca istegi kaydeder ve
+ * impact_timer'i baslatir. Hold-off karari, FIFO'nun yeniden kurulmasi,
+ * okumalar ve yayin event loop'ta impact_service() ile yapilir; boylece
+ * listener adxl_event_chan tutulurken beklemez. Ilk servis datasheet'in
+ * tetikleme sonrasi bekleme suresinden sonradir. Kayit sonrasi
+ * IMPACT_HOLDOFF_MS icindeki olaylar yalnizca FIFO'yu yeniden kurar; toplama
+ * surerken gelen olaylar yok sayilir.
+ */
+private void impact_event_cb( const struct zbus_channel *chan )
+{
+    const struct adxl345_event *event = zbus_chan_const_msg(chan);
+
+    if (!armed || capturing || trigger_pending || !(event->source & ADXL_INT_SOURCE_ACTIVITY)) {
+        return;
+    }
+
+    trigger_pending = true;
+    trigger_ms = event->timestamp;
+    k_timer_start(&impact_timer, K_USEC(IMPACT_TRIGGER_SETTLE_US), K_USEC(arm_step_us));
+}
+
+ZBUS_LISTENER_DEFINE(impact_listener, impact_event_cb);
+ZBUS_CHAN_ADD_OBS(adxl_event_chan, impact_listener, 1);
+
+
+private int read_reg( uint8_t reg , uint8_t *value )
+{
+    const struct adxl345_bus *bus = adxl345_get_bus();
+
+    spi_bus_acquire(bus, SPI_BUS_CLASS_BULK, 0);
+    int err = adxl345_read_reg(bus, reg, value, 1);
+    spi_bus_release();
+    return err;
+}
+
+/**
+ * @brief POWER_CTL'i yazar. AUTO_SLEEP/LINK degisirken datasheet'in onerdigi
+ *        gibi once standby'a gecilir, sonra istenen deger yazilir.
+ */
+private int write_power_ctl( uint8_t value )
+{
+    int err = adxl345_update_reg(ADXL345_POWER_CTL, ADXL_POWER_CTL_MEASURE, 0);
+
+    if (!err) {
+        err = adxl345_update_reg(ADXL345_POWER_CTL, 0xFF, value);
+    }
+    return err;
+}
+
+/**
+ * @brief Ilk hatayi korur; sonraki adimlar hata olsa da calistirilir.
+ */
+private inline int first_error( int err , int step )
+{
+    return err ? err : step;
+}
+
+/**
+ * @brief Kurulum oncesi ayarlari geri yukler. Hatalarda devam eder, ilk hatayi dondurur.
+ */
+private int restore( void )
+{
+    int err = adxl345_fifo_configure(ADXL_FIFO_CTL_MODE_BYPASS);
+
+    err = first_error(err, adxl345_update_reg(ADXL345_POWER_CTL, ADXL_POWER_CTL_MEASURE, 0));
+    err = first_error(err, adxl345_set_bw_rate(saved.config.bw_rate));
+    err = first_error(err, adxl345_set_full_res(saved.config.data_format & ADXL_DATA_FORMAT_FULL_RES));
+    err = first_error(err, adxl345_set_range(saved.config.data_format & ADXL_DATA_FORMAT_RANGE_MASK));
+    err = first_error(err, adxl345_set_thresh_act(saved.config.thresh_act));
+    err = first_error(err, adxl345_update_reg(ADXL345_ACT_INACT_CTL, 0xF0, saved.act_inact_ctl));
+    err = first_error(err, write_power_ctl(saved.power_ctl));
+    return err;
+}
+
+/**
+ * @brief impact_arm() govdesi; impact_lock tutulurken cagrilir.
+ */
+private int arm_locked( uint8_t bw_rate , uint8_t pre , uint16_t post , uint16_t thresh_mg )
+{
+    int err;
+
+    if (armed) {
+        return -EALREADY;
+    }
+    if (sample_pipeline_is_running()) {
+        return -EBUSY;
+    }
+
+    adxl345_get_config(&saved.config);
+    err = read_reg(ADXL345_ACT_INACT_CTL, &saved.act_inact_ctl);
+    if (!err) {
+        err = read_reg(ADXL345_POWER_CTL, &saved.power_ctl);
+    }
+    if (err) {
+        return err;
+    }
+
+    arm_bw_rate = bw_rate;
+    arm_pre = pre;
+    arm_post = post;
+    arm_thresh_mg = thresh_mg;
+    arm_step_us = (uint32_t)(((uint64_t)(ADXL345_FIFO_DEPTH / 2) * 1000000000ULL) / adxl345_odr_mhz(bw_rate));
+
+    /* 62.5 mg/LSB: mg * 2 / 125 */
+    uint8_t thresh = (uint8_t)MIN((thresh_mg * 2 + 62) / 125, ADXL_THRESH_ACT_MAX);
+
+    err = adxl345_update_reg(ADXL345_POWER_CTL, ADXL_POWER_CTL_MEASURE, 0);
+    if (!err) {
+        err = adxl345_set_bw_rate(bw_rate);
+    }
+    if (!err) {
+        err = adxl345_set_full_res(true);
+    }
+    if (!err) {
+        err = adxl345_set_range(ADXL_DATA_FORMAT_RANGE_16G);
+    }
+    if (!err) {
+        err = adxl345_set_thresh_act(thresh);
+    }
+    if (!err) {
+        err = adxl345_update_reg(ADXL345_ACT_INACT_CTL, 0xF0, ADXL_ACT_INACT_CTL_ACT_AC_DC |
+                                 ADXL_ACT_INACT_CTL_ACT_X_ENABLE | ADXL_ACT_INACT_CTL_ACT_Y_ENABLE |
+                                 ADXL_ACT_INACT_CTL_ACT_Z_ENABLE);
+    }
+    if (!err) {
+        err = rearm();
+    }
+    if (!err) {
+        err = write_power_ctl(saved.power_ctl & ~(ADXL_POWER_CTL_LINK | ADXL_POWER_CTL_AUTO_SLEEP));
+    }
+    if (err) {
+        LOG_ERROR("[%s]: Darbe kaydi kurulamadi! Hata Kodu: %d", __func__, err);
+        restore();
+        return err;
+    }
+
+    trigger_pending = false;
+    capturing = false;
+    armed = true;
+    LOG_INFO("[%s]: Darbe kaydi kuruldu (BW_RATE=0x%02X, %u + %u ornek, %u mg)", __func__,
+             bw_rate, pre, post, thresh_mg);
+    return 0;
+}
+
+/**
+ * @brief Darbe kaydini kurar.
+ *
+ * Sensor standby'a alinir; ODR, ±16 g FULL_RES, aktivite esigi ve uc eksen AC
+ * aktivite ayarlanir, LINK ve AUTO_SLEEP kapatilir (her darbe ayri tetiklesin
+ * ve on-tetikleme tamponu kayit hizinda kalsin), FIFO trigger moduna alinir ve
+ * olcum yeniden baslatilir. AC modda sensor olcumun basindaki ivmeyi referans
+ * alir ve esigi bu referanstan farka uygular; tetikleme cihazin yonunden
+ * (yercekiminin hangi eksende oldugundan) bagimsizdir.
+ *
+ * @param bw_rate   Kayit hizi (ADXL_BW_RATE_100HZ..ADXL_BW_RATE_3200HZ). Daha dusuk
+ *                  hizlarda yarim FIFO araligi 160 ms'yi asar ve on-tetikleme
+ *                  penceresi darbeden cok once baslar.
+ * @param pre       Korunacak on-tetikleme ornegi (1..31).
+ * @param post      Tetikleme sonrasi ornek; pre + post <= IMPACT_MAX_SAMPLES.
+ * @param thresh_mg Tetikleme ve sure esigi (63..15937 mg; 62.5 mg/LSB).
+ * @return Basariliysa 0; gecersiz argumanda -EINVAL, pipeline calisiyorsa -EBUSY,
+ *         zaten kuruluysa -EALREADY, aksi halde hata kodu.
+ */
+public int impact_arm(uint8_t bw_rate, uint8_t pre, uint16_t post, uint16_t thresh_mg)
+{
+    if ((bw_rate & ~ADXL_BW_RATE_3200HZ) || bw_rate < IMPACT_MIN_BW_RATE || pre == 0 || pre > ADXL_FIFO_CTL_SAMPLES_MASK ||
+        post == 0 || pre + post > IMPACT_MAX_SAMPLES || thresh_mg < 63 || thresh_mg > 15937) {
+        return -EINVAL;
+    }
+
+    k_mutex_lock(&impact_lock, K_FOREVER);
+    int err = arm_locked(bw_rate, pre, post, thresh_mg);
+    k_mutex_unlock(&impact_lock);
+    return err;
+}
+
+/**
+ * @brief Darbe kaydini kaldirir ve kurulum oncesi ayarlari geri yukler.
+ *
+ * impact_lock altinda calisir; suren bir FIFO okumasi bitmeden geri yukleme
+ * baslamaz ve sonraki impact_service() kurulumun kalktigini gorup FIFO'ya
+ * dokunmaz. Yarim kalan kayit yayinlanmaz.
+ */
+public int impact_disarm(void)
+{
+    k_mutex_lock(&impact_lock, K_FOREVER);
+    if (!armed) {
+        k_mutex_unlock(&impact_lock);
+        return 0;
+    }
+
+    armed = false;
+    k_timer_stop(&impact_timer);
+    int err = restore();
+    k_mutex_unlock(&impact_lock);
+
+    if (err) {
+        LOG_ERROR("[%s]: Ayarlar geri yuklenemedi! Hata Kodu: %d", __func__, err);
+    }
+    return err;
+}
+
+public bool impact_is_armed(void)
+{
+    return armed;
+}
+
+
+#if defined(CONFIG_SHELL)
+#include <zephyr/shell/shell.h>
+
+/**
+ * @brief adxl impact arm [bw_rate] [pre] [post] [esik_mg]; verilmeyenler varsayilan.
+ */
+private int cmd_impact_arm(const struct shell *sh, size_t argc, char **argv)
+{
+    unsigned long args[] = { IMPACT_DEFAULT_BW_RATE, IMPACT_DEFAULT_PRE, IMPACT_DEFAULT_POST,
+                             IMPACT_DEFAULT_THRESH_MG };
+    int err = 0;
+
+    for (size_t i = 1; i < argc && i <= ARRAY_SIZE(args); i++) {
+        args[i - 1] = shell_strtoul(argv[i], 0, &err);
+    }
+    if (err || args[0] > UINT8_MAX || args[1] > UINT8_MAX || args[2] > UINT16_MAX || args[3] > UINT16_MAX) {
+        shell_error(sh, "Gecersiz arguman");
+        return -EINVAL;
+    }
+
+    err = impact_arm(args[0], args[1], args[2], args[3]);
+    if (err) {
+        shell_error(sh, "Kurulamadi: %d", err);
+        return err;
+    }
+    shell_print(sh, "Kuruldu: %lu + %lu ornek, esik %lu mg", args[1], args[2], args[3]);
+    return 0;
+}
+
+private int cmd_impact_disarm(const struct shell *sh, size_t argc, char **argv)
+{
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    int err = impact_disarm();
+    if (err) {
+        shell_error(sh, "Ayarlar geri yuklenemedi: %d", err);
+    }
+    return err;
+}
+
+private int cmd_impact_show(const struct shell *sh, size_t argc, char **argv)
+{
+    struct impact_record record;
+
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    k_spinlock_key_t key = k_spin_lock(&last_lock);
+    record = last_record;
+    k_spin_unlock(&last_lock, key);
+
+    shell_print(sh, "durum : %s, kayit %u", armed ? "kurulu" : "kapali", record_seq);
+    if (record_seq == 0) {
+        return 0;
+    }
+    shell_print(sh, "son   : #%u, %u ms, %u ornek (tetikleme %u), BW_RATE 0x%02X%s", record.seq,
+                record.timestamp, record.count, record.trigger_index, record.bw_rate,
+                record.lost ? ", ornek kaybi" : "");
+    shell_print(sh, "tepe  : %u mg (ornek %u), sure %u us", record.peak_mg, record.peak_index,
+                record.duration_us);
+    return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_impact,
+    SHELL_CMD_ARG(arm,    NULL, "Kur: arm [bw_rate] [on] [son] [esik_mg]", cmd_impact_arm,    1, 4),
+    SHELL_CMD_ARG(disarm, NULL, "Kaldir ve ayarlari geri yukle",           cmd_impact_disarm, 1, 0),
+    SHELL_CMD_ARG(show,   NULL, "Son darbe kaydi",                         cmd_impact_show,   1, 0),
+    SHELL_SUBCMD_SET_END
+);
+
+SHELL_SUBCMD_ADD((adxl), impact, &sub_impact, "FIFO trigger modu ile darbe kaydi", NULL, 0, 0);
+#endif
@@ -0,0 +1,83 @@
+/**
+ * @file impact.h
+ * @brief FIFO trigger modu ile on-tetikleme tamponlu darbe (shock) kaydi
+ *
+ * Kurulduginda (arm) sensor kayit hizina (ornegin 3200 Hz) ve ±16 g FULL_RES
+ * moduna alinir, FIFO trigger moduna gecer ve aktivite interrupt'u tetikleyici
+ * olur. Tetiklemeye kadar MCU hic uyanmaz; FIFO son orneklerini surekli
+ * tazeler. Aktivite olayi geldiginde FIFO, tetikleme oncesi `pre` ornegi
+ * korur; ardindan tetikleme sonrasi `post` ornek FIFO dolmadan parcali olarak
+ * (burst) okunur. Okumalar bir zamanlayicinin verdigi semafor ile event
+ * loop'ta (impact_service) yapilir; aralarda thread bloklanmaz. Tum olay tek
+ * bir bitisik tamponda `impact_chan` kanalina yayinlanir; tepe ivme ve sure
+ * hesaplanmis olarak gelir.
+ *
+ * @note Trigger modunda on-tetikleme ornekleri FIFO'nun calistigi hizda
+ *       toplanir; bu nedenle sensor kurulu kaldigi surece kayit hizinda
+ *       calisir (3200 Hz'de ~140 µA). Dusuk ODR ve auto-sleep, kurulum
+ *       kaldirildiginda (disarm) geri yuklenir.
+ */
+#ifndef IMPACT_H
+#define IMPACT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "adxl345.h"
+#include <zephyr/zbus/zbus.h>
+
+/** @brief Bir kaydin en fazla ornek sayisi (on + son tetikleme) */
+#define IMPACT_MAX_SAMPLES          160
+
+/** @brief Varsayilan kurulum: 3200 Hz, 16 on, 112 son ornek (~40 ms), 2 g esik */
+#define IMPACT_DEFAULT_BW_RATE      ADXL_BW_RATE_3200HZ
+#define IMPACT_DEFAULT_PRE          16
+#define IMPACT_DEFAULT_POST         112
+#define IMPACT_DEFAULT_THRESH_MG    2000
+
+/** @brief En dusuk kayit hizi; yarim FIFO araligi 160 ms */
+#define IMPACT_MIN_BW_RATE          ADXL_BW_RATE_100HZ
+
+/** @brief Bir kayittan sonra yeni olaylarin yok sayildigi sure (ms) */
+#define IMPACT_HOLDOFF_MS           200
+
+/** @brief Son tetikleme orneklerini beklerken ilerleme olmazsa vazgecme carpani (bekleme adimi cinsinden) */
+#define IMPACT_STALL_STEPS          4
+
+/**
+ * @brief Bir darbe kaydi.
+ *
+ * `samples` modulun tamponunu gosterir ve yalnizca listener geri cagirmasi
+ * suresince gecerlidir. Ornekler FULL_RES LSB'dir (3.9 mg).
+ */
+struct impact_record {
+    const struct adxl345_sample *samples;   /*!< On + son tetikleme ornekleri, bitisik     */
+    uint16_t count;                         /*!< Toplam ornek                              */
+    uint16_t trigger_index;                 /*!< Ilk son-tetikleme orneginin indeksi       */
+    uint16_t peak_index;                    /*!< Tepe orneginin indeksi                    */
+    uint16_t peak_mg;                       /*!< Tepe ivme, on-tetikleme ortalamasi (yercekimi) cikarilmis */
+    uint32_t duration_us;                   /*!< Esigi asan ilk ve son ornek arasi sure    */
+    uint8_t bw_rate;                        /*!< Kayit hizi                                */
+    bool lost;                              /*!< FIFO doldu; son pencerede ornek kaybi olabilir */
+    uint32_t seq;                           /*!< Kayit sira numarasi                       */
+    uint32_t timestamp;                     /*!< Tetikleme olayinin islendigi an (ms)      */
+};
+
+ZBUS_CHAN_DECLARE(impact_chan);
+
+public int impact_arm(uint8_t bw_rate, uint8_t pre, uint16_t post, uint16_t thresh_mg);
+public int impact_disarm(void);
+#if defined(CONFIG_APP_IMPACT)
+public bool impact_is_armed(void);
+#else
+static inline bool impact_is_armed(void) { return false; }
+#endif
+public void impact_analyze(struct impact_record *record, uint16_t thresh_mg);
+public void impact_service(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // IMPACT_H
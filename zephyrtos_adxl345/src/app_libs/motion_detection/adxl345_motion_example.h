@@ -0,0 +1,22 @@
+/**
+ * @file adxl345_motion_example.h
+ * @brief Hareket algilandiginda yapilacak islemler (ornek)
+ *
+ * @author uzunberkay
+ */
+#ifndef ADXL345_MOTION_EXAMPLE_H
+#define ADXL345_MOTION_EXAMPLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "utils.h"
+
+public void motion_event_handler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ADXL345_MOTION_EXAMPLE_H
@@ -0,0 +1,280 @@
+#include "orientation.h"
+#include "sample_pipeline.h"
+#include "fxmath.h"
+#include "utils.h"
+#include <zephyr/kernel.h>
+
+LOG_MODULE_REGISTER(orientation, LOG_LEVEL_INF);
+
+ZBUS_CHAN_DEFINE(orientation_chan,
+                 struct orientation_state,
+                 NULL,
+                 NULL,
+                 ZBUS_OBSERVERS_EMPTY,
+                 ZBUS_MSG_INIT(0));
+
+static int32_t filt_q[3];
+static bool filt_ready;
+
+static uint8_t candidate;
+static uint32_t candidate_since;
+
+static struct orientation_state current;
+static struct k_spinlock current_lock;
+
+
+/**
+ * @brief Yercekimine en yakin ekseni, koni sartini sagliyorsa dondurur.
+ *
+ * Baskin bilesenin karesi toplam buyuklugun karesinin cos^2(35 derece)
+ * katindan kucukse vektor iki eksen arasindadir ve ORIENTATION_UNKNOWN doner.
+ */
+private uint8_t classify( const struct adxl345_sample *mg , uint32_t mag2 )
+{
+    uint32_t x2 = mg->x * mg->x;
+    uint32_t y2 = mg->y * mg->y;
+    uint32_t z2 = mg->z * mg->z;
+    uint32_t limit = (uint32_t)(((uint64_t)mag2 * ORIENTATION_CONE_COS2_PERMILLE) / 1000);
+
+    if (z2 >= x2 && z2 >= y2) {
+        return (z2 < limit) ? ORIENTATION_UNKNOWN
+             : (mg->z > 0) ? ORIENTATION_FACE_UP : ORIENTATION_FACE_DOWN;
+    }
+    if (y2 >= x2) {
+        return (y2 < limit) ? ORIENTATION_UNKNOWN
+             : (mg->y > 0) ? ORIENTATION_PORTRAIT_UP : ORIENTATION_PORTRAIT_DOWN;
+    }
+    return (x2 < limit) ? ORIENTATION_UNKNOWN
+         : (mg->x > 0) ? ORIENTATION_LANDSCAPE_LEFT : ORIENTATION_LANDSCAPE_RIGHT;
+}
+
+/**
+ * @brief Tek bir vektor icin pitch, roll ve aday yonelimi hesaplar.
+ *
+ * Yalnizca tamsayi islem kullanilir: bir karekok ve iki atan2 (her biri tek
+ * bolme). Zaman damgasina dokunulmaz.
+ *
+ * @param mg  Ivme vektoru (mg, eksen basina ±16000).
+ * @param out Sonuc.
+ */
+public void orientation_compute(const struct adxl345_sample *mg, struct orientation_state *out)
+{
+    uint32_t yz2 = (uint32_t)(mg->y * mg->y) + (uint32_t)(mg->z * mg->z);
+    uint32_t mag2 = yz2 + (uint32_t)(mg->x * mg->x);
+
+    out->pitch_cdeg = (int16_t)fx_atan2_cdeg(-mg->x, (int32_t)fx_isqrt32(yz2));
+    out->roll_cdeg = (int16_t)fx_atan2_cdeg(mg->y, mg->z);
+    out->orientation = classify(mg, mag2);
+}
+
+/**
+ * @brief Son hesaplanan egimi ve yayinlanmis yonelimi okur.
+ */
+public void orientation_get(struct orientation_state *state)
+{
+    k_spinlock_key_t key = k_spin_lock(&current_lock);
+    *state = current;
+    k_spin_unlock(&current_lock, key);
+}
+
+public const char *orientation_name(uint8_t orientation)
+{
+    static const char *const names[] = {
+        [ORIENTATION_UNKNOWN]           = "bilinmiyor",
+        [ORIENTATION_FACE_UP]           = "yuz yukari",
+        [ORIENTATION_FACE_DOWN]         = "yuz asagi",
+        [ORIENTATION_PORTRAIT_UP]       = "dikey",
+        [ORIENTATION_PORTRAIT_DOWN]     = "dikey ters",
+        [ORIENTATION_LANDSCAPE_LEFT]    = "yatay sol",
+        [ORIENTATION_LANDSCAPE_RIGHT]   = "yatay sag",
+    };
+
+    return (orientation < ARRAY_SIZE(names)) ? names[orientation] : "?";
+}
+
+/**
+ * @brief Aday yonelimi debounce sartina gore degerlendirir, degistiyse yayinlar.
+ *
+ * Aday bilinmiyorsa (eksenler arasi histerezis bandi) mevcut yonelim korunur.
+ */
+private void update_orientation( const struct orientation_state *sample )
+{
+    if (sample->orientation == ORIENTATION_UNKNOWN || sample->orientation == current.orientation) {
+        candidate = current.orientation;
+        return;
+    }
+    if (sample->orientation != candidate) {
+        candidate = sample->orientation;
+        candidate_since = sample->timestamp;
+        return;
+    }
+    if (sample->timestamp - candidate_since < ORIENTATION_DEBOUNCE_MS) {
+        return;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&current_lock);
+    current.orientation = candidate;
+    struct orientation_state published = current;
+    k_spin_unlock(&current_lock, key);
+
+    LOG_DEBUG("[%s]: Yonelim: %s", __func__, orientation_name(published.orientation));
+    zbus_chan_pub(&orientation_chan, &published, K_NO_WAIT);
+}
+
+/**
+ * @brief Blok orneklerini filtreler; blok sonunda egim ve yonelimi gunceller.
+ *
+ * Buyuklugu 1 g civarinda olmayan (hareket halindeki) vektorler yonelim
+ * kararinda kullanilmaz.
+ */
+private void orientation_block_cb( const struct zbus_channel *chan )
+{
+    const struct adxl345_block *block = zbus_chan_const_msg(chan);
+
+    uint8_t shift = adxl345_lsb_shift(block->data_format);
+
+    if (block->count == 0) {
+        return;
+    }
+
+    for (int i = 0; i < block->count; i++) {
+        int32_t mg[3] = {
+            adxl345_lsb_to_mg(block->samples[i].x, shift),
+            adxl345_lsb_to_mg(block->samples[i].y, shift),
+            adxl345_lsb_to_mg(block->samples[i].z, shift),
+        };
+
+        for (int a = 0; a < 3; a++) {
+            if (!filt_ready) {
+                filt_q[a] = mg[a] * (1 << ORIENTATION_FILTER_SHIFT);
+            }
+            filt_q[a] += (mg[a] * (1 << ORIENTATION_FILTER_SHIFT) - filt_q[a]) >> ORIENTATION_FILTER_SHIFT;
+        }
+        filt_ready = true;
+    }
+
+    struct adxl345_sample vec = {
+        .x = (int16_t)(filt_q[0] >> ORIENTATION_FILTER_SHIFT),
+        .y = (int16_t)(filt_q[1] >> ORIENTATION_FILTER_SHIFT),
+        .z = (int16_t)(filt_q[2] >> ORIENTATION_FILTER_SHIFT),
+    };
+    uint32_t mag = fx_magnitude3(vec.x, vec.y, vec.z);
+
+    if (mag < ORIENTATION_MIN_MG || mag > ORIENTATION_MAX_MG) {
+        return;
+    }
+
+    struct orientation_state sample = { .timestamp = block->timestamp };
+    orientation_compute(&vec, &sample);
+
+    k_spinlock_key_t key = k_spin_lock(&current_lock);
+    current.pitch_cdeg = sample.pitch_cdeg;
+    current.roll_cdeg = sample.roll_cdeg;
+    current.timestamp = sample.timestamp;
+    k_spin_unlock(&current_lock, key);
+
+    update_orientation(&sample);
+}
+
+ZBUS_LISTENER_DEFINE(orientation_listener, orientation_block_cb);
+ZBUS_CHAN_ADD_OBS(adxl_block_chan, orientation_listener, 3);
+
+
+#if defined(CONFIG_SHELL)
+#include <zephyr/shell/shell.h>
+#include <math.h>
+
+/** @brief Benchmark izgarasi: pitch -85..85, roll -180..175 derece */
+#define ORIENT_BENCH_STEP_DEG   5
+#define ORIENT_BENCH_PITCH_MAX  85
+
+/**
+ * @brief Iki aci arasindaki farkin mutlak degeri (santiderece, ±180 sarmali).
+ */
+private int32_t angle_error( int32_t a , int32_t b )
+{
+    int32_t diff = a - b;
+
+    if (diff > 18000) {
+        diff -= 36000;
+    } else if (diff < -18000) {
+        diff += 36000;
+    }
+    return (diff < 0) ? -diff : diff;
+}
+
+/**
+ * @brief Tamsayi yolu libm (atan2f/sqrtf) referansi ile karsilastirir.
+ *
+ * 1 g buyuklugunde, mg'ye yuvarlanmis vektorlerden olusan bir izgara kullanilir;
+ * referans ayni yuvarlanmis vektorden hesaplandigi icin hata yalnizca
+ * yaklasimdan kaynaklanir. Ornek basina cycle her iki yol icin raporlanir.
+ */
+private int cmd_orient_bench(const struct shell *sh, size_t argc, char **argv)
+{
+    const float deg = 3.14159265f / 180.0f;
+    uint64_t fixed_cycles = 0, float_cycles = 0;
+    int32_t max_pitch_err = 0, max_roll_err = 0;
+    uint32_t count = 0;
+    volatile float sink = 0.0f;
+
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    for (int p = -ORIENT_BENCH_PITCH_MAX; p <= ORIENT_BENCH_PITCH_MAX; p += ORIENT_BENCH_STEP_DEG) {
+        for (int r = -180; r < 180; r += ORIENT_BENCH_STEP_DEG) {
+            struct adxl345_sample mg = {
+                .x = (int16_t)lroundf(-sinf(p * deg) * 1000.0f),
+                .y = (int16_t)lroundf(cosf(p * deg) * sinf(r * deg) * 1000.0f),
+                .z = (int16_t)lroundf(cosf(p * deg) * cosf(r * deg) * 1000.0f),
+            };
+            struct orientation_state fixed;
+
+            uint32_t start = k_cycle_get_32();
+            orientation_compute(&mg, &fixed);
+            fixed_cycles += k_cycle_get_32() - start;
+
+            start = k_cycle_get_32();
+            float ref_pitch = atan2f(-mg.x, sqrtf((float)mg.y * mg.y + (float)mg.z * mg.z));
+            float ref_roll = atan2f(mg.y, mg.z);
+            float_cycles += k_cycle_get_32() - start;
+            sink += ref_pitch + ref_roll;
+
+            int32_t pe = angle_error(fixed.pitch_cdeg, (int32_t)lroundf(ref_pitch / deg * 100.0f));
+            int32_t re = angle_error(fixed.roll_cdeg, (int32_t)lroundf(ref_roll / deg * 100.0f));
+
+            max_pitch_err = MAX(max_pitch_err, pe);
+            max_roll_err = MAX(max_roll_err, re);
+            count++;
+        }
+    }
+
+    shell_print(sh, "vektor        : %u", count);
+    shell_print(sh, "en buyuk hata : pitch %d.%02d, roll %d.%02d derece",
+                max_pitch_err / 100, max_pitch_err % 100, max_roll_err / 100, max_roll_err % 100);
+    shell_print(sh, "ornek basina  : tamsayi %llu cycle, libm %llu cycle",
+                fixed_cycles / count, float_cycles / count);
+    return 0;
+}
+
+private int cmd_orient_show(const struct shell *sh, size_t argc, char **argv)
+{
+    struct orientation_state state;
+
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    orientation_get(&state);
+    shell_print(sh, "%s, pitch %d, roll %d (0.01 derece, %u ms)", orientation_name(state.orientation),
+                state.pitch_cdeg, state.roll_cdeg, state.timestamp);
+    return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_orient,
+    SHELL_CMD_ARG(show,  NULL, "Egim ve yonelim",                      cmd_orient_show,  1, 0),
+    SHELL_CMD_ARG(bench, NULL, "libm referansina gore hata ve sure",   cmd_orient_bench, 1, 0),
+    SHELL_SUBCMD_SET_END
+);
+
+SHELL_SUBCMD_ADD((adxl), orient, &sub_orient, "Egim ve yonelim", NULL, 0, 0);
+#endif
@@ -0,0 +1,68 @@
+/**
+ * @file orientation.h
+ * @brief Statik ivme vektorunden egim (pitch/roll) ve yonelim durumu
+ *
+ * Sample pipeline bloklari mg'ye cevrilip alcak geciren filtreden gecirilir;
+ * her blok sonunda filtreli vektor icin pitch/roll tamsayi atan2 ile
+ * hesaplanir ve yercekiminin hangi eksene yakin oldugu siniflandirilir.
+ * Yonelim degisikligi koni (histerezis) ve sure (debounce) sartini
+ * sagladiginda `orientation_chan` kanalina yayinlanir; degisiklik yoksa
+ * yayin yapilmaz.
+ */
+#ifndef ORIENTATION_H
+#define ORIENTATION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "adxl345.h"
+#include <zephyr/zbus/zbus.h>
+
+/** @brief Vektor filtresi katsayisi (1/2^n ustel ortalama) */
+#define ORIENTATION_FILTER_SHIFT        2
+
+/**
+ * @brief Yeni yonelime gecis icin eksen konisi: cos^2(35 derece) * 1000.
+ * Eksenler arasi 45 derecelik sinirin iki yanindaki 10 derece histerezis bandidir;
+ * bu bantta mevcut yonelim korunur.
+ */
+#define ORIENTATION_CONE_COS2_PERMILLE  671
+
+/** @brief Yeni yonelimin yayinlanmadan once korunmasi gereken sure (ms) */
+#define ORIENTATION_DEBOUNCE_MS         300
+
+/** @brief Vektorun statik sayilmasi icin buyukluk siniri (mg) */
+#define ORIENTATION_MIN_MG              800
+#define ORIENTATION_MAX_MG              1200
+
+/** @brief Yonelim durumlari (yukari bakan eksene gore) */
+enum orientation {
+    ORIENTATION_UNKNOWN = 0,
+    ORIENTATION_FACE_UP,            /*!< +Z yukari      */
+    ORIENTATION_FACE_DOWN,          /*!< -Z yukari      */
+    ORIENTATION_PORTRAIT_UP,        /*!< +Y yukari      */
+    ORIENTATION_PORTRAIT_DOWN,      /*!< -Y yukari      */
+    ORIENTATION_LANDSCAPE_LEFT,     /*!< +X yukari      */
+    ORIENTATION_LANDSCAPE_RIGHT,    /*!< -X yukari      */
+};
+
+/** @brief Egim ve yonelim bilgisi */
+struct orientation_state {
+    uint8_t orientation;            /*!< enum orientation                        */
+    int16_t pitch_cdeg;             /*!< Pitch, -9000..9000 santiderece          */
+    int16_t roll_cdeg;              /*!< Roll, -18000..18000 santiderece         */
+    uint32_t timestamp;             /*!< Hesaplandigi blogun zamani (ms)         */
+};
+
+ZBUS_CHAN_DECLARE(orientation_chan);
+
+public void orientation_compute(const struct adxl345_sample *mg, struct orientation_state *out);
+public void orientation_get(struct orientation_state *state);
+public const char *orientation_name(uint8_t orientation);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ORIENTATION_H
@@ -0,0 +1,435 @@
+#include "pedometer.h"
+#include "sample_pipeline.h"
+#include "fxmath.h"
+#include "utils.h"
+#include <string.h>
+#include <zephyr/kernel.h>
+
+LOG_MODULE_REGISTER(pedometer, LOG_LEVEL_INF);
+
+BUILD_ASSERT((PEDOMETER_SMOOTH_LEN & (PEDOMETER_SMOOTH_LEN - 1)) == 0,
+             "PEDOMETER_SMOOTH_LEN 2'nin kuvveti olmali");
+
+/**
+ * @brief Canli (pipeline'a bagli) adim sayar.
+ *
+ * Filtre ve tepe algilama her blokta 25 ornek uzerinden calistigi icin kilit
+ * bir mutex'tir; spinlock interrupt'lari bu sure boyunca kapatirdi.
+ */
+static struct pedometer live;
+static K_MUTEX_DEFINE(live_lock);
+static bool live_enabled;
+static bool live_suspended;
+
+
+/**
+ * @brief Motoru baslangic durumuna getirir.
+ */
+public void pedometer_init(struct pedometer *ped)
+{
+    memset(ped, 0, sizeof(*ped));
+}
+
+/**
+ * @brief Sensor uykuya gectiginde motoru duraklatir.
+ *
+ * Adim sayisi korunur; filtreler ve kadans dogrulamasi bir sonraki ornekle
+ * yeniden baslar. Uyku suresi adim araligi olarak yorumlanmaz.
+ */
+public void pedometer_pause(struct pedometer *ped)
+{
+    ped->primed = false;
+    ped->counting = false;
+    ped->regulation = 0;
+}
+
+/**
+ * @brief Filtreleri ilk ornekle baslatir.
+ */
+private void prime(struct pedometer *ped, int32_t mag)
+{
+    ped->baseline_q = mag << PEDOMETER_BASELINE_SHIFT;
+    memset(ped->smooth, 0, sizeof(ped->smooth));
+    ped->smooth_sum = 0;
+    ped->smooth_pos = 0;
+    ped->above = false;
+    ped->win_max = INT32_MIN;
+    ped->win_min = INT32_MAX;
+    ped->win_count = 0;
+    ped->threshold = 0;
+    ped->p2p = 0;
+    ped->primed = true;
+}
+
+/**
+ * @brief Esik altina inen bir tepeyi adim adayi olarak degerlendirir.
+ *
+ * Cok kisa araliklar (titresim, sarsinti) yok sayilir. Cok uzun bir aralik
+ * yurumenin kesildigini gosterir; dogrulama bastan baslar. Dogrulama
+ * sirasinda biriken adimlar sayma basladiginda toplama eklenir.
+ */
+private void step_candidate(struct pedometer *ped)
+{
+    uint32_t interval_ms = (uint32_t)((ped->time_us - ped->last_step_us) / 1000);
+
+    if (!ped->counting && ped->regulation == 0) {
+        ped->regulation = 1;
+        ped->last_step_us = ped->time_us;
+        return;
+    }
+    if (interval_ms < PEDOMETER_MIN_INTERVAL_MS) {
+        return;
+    }
+
+    ped->last_step_us = ped->time_us;
+
+    if (interval_ms > PEDOMETER_MAX_INTERVAL_MS) {
+        ped->counting = false;
+        ped->regulation = 1;
+        return;
+    }
+
+    if (ped->counting) {
+        ped->steps++;
+        ped->interval_avg_ms += ((int32_t)interval_ms - (int32_t)ped->interval_avg_ms) / 4;
+        return;
+    }
+
+    ped->interval_avg_ms = (ped->regulation == 1) ? interval_ms
+                         : (ped->interval_avg_ms + interval_ms) / 2;
+    if (++ped->regulation >= PEDOMETER_REGULATION_STEPS) {
+        ped->steps += ped->regulation;
+        ped->regulation = 0;
+        ped->counting = true;
+    }
+}
+
+/**
+ * @brief mg cinsinden ornekleri motora besler.
+ *
+ * @param ped     Motor durumu.
+ * @param mg      Ornekler (mg).
+ * @param count   Ornek sayisi.
+ * @param odr_mhz Orneklerin alindigi veri hizi (mHz).
+ */
+public void pedometer_feed_mg(struct pedometer *ped, const struct adxl345_sample *mg, uint32_t count, uint32_t odr_mhz)
+{
+    uint32_t period_us = 1000000000U / odr_mhz;
+
+    for (uint32_t i = 0; i < count; i++) {
+        int32_t mag = (int32_t)fx_magnitude3(mg[i].x, mg[i].y, mg[i].z);
+
+        if (!ped->primed) {
+            prime(ped, mag);
+        }
+
+        /* Yercekimi bileseni: ustel ortalama; kalan AC bilesen hareketli ortalama ile yumusatilir */
+        ped->baseline_q += ((mag << PEDOMETER_BASELINE_SHIFT) - ped->baseline_q) >> PEDOMETER_BASELINE_SHIFT;
+        int32_t ac = mag - (ped->baseline_q >> PEDOMETER_BASELINE_SHIFT);
+
+        ped->smooth_sum += ac - ped->smooth[ped->smooth_pos];
+        ped->smooth[ped->smooth_pos] = ac;
+        ped->smooth_pos = (ped->smooth_pos + 1) & (PEDOMETER_SMOOTH_LEN - 1);
+        int32_t v = ped->smooth_sum / PEDOMETER_SMOOTH_LEN;
+
+        ped->time_us += period_us;
+
+        /* Esik ve genlik bir onceki pencereden gelir; pencere dolunca yenilenir */
+        if (v > ped->win_max) {
+            ped->win_max = v;
+        }
+        if (v < ped->win_min) {
+            ped->win_min = v;
+        }
+        if (++ped->win_count >= PEDOMETER_THRESH_WINDOW) {
+            ped->threshold = (ped->win_max + ped->win_min) / 2;
+            ped->p2p = ped->win_max - ped->win_min;
+            ped->win_max = INT32_MIN;
+            ped->win_min = INT32_MAX;
+            ped->win_count = 0;
+        }
+
+        int32_t hysteresis = ped->p2p / 8;
+
+        if (ped->above && v < ped->threshold - hysteresis) {
+            ped->above = false;
+            if (ped->p2p >= PEDOMETER_MIN_P2P_MG) {
+                step_candidate(ped);
+            }
+        } else if (!ped->above && v > ped->threshold + hysteresis) {
+            ped->above = true;
+        }
+    }
+}
+
+/**
+ * @brief Kadansi (adim/dk) dondurur; yurume dogrulanmamissa veya son adimin
+ *        uzerinden PEDOMETER_MAX_INTERVAL_MS gectiyse 0 dondurur.
+ */
+public uint16_t pedometer_cadence(const struct pedometer *ped)
+{
+    if (!ped->counting || ped->interval_avg_ms == 0 ||
+        ped->time_us - ped->last_step_us > PEDOMETER_MAX_INTERVAL_MS * 1000ULL) {
+        return 0;
+    }
+    return (uint16_t)(60000U / ped->interval_avg_ms);
+}
+
+
+/**
+ * @brief FIFO bloklarini mg'ye cevirip canli motora besler.
+ *
+ * Sensor uykudayken (inaktivite) FIFO'ya dusuk hizda ornek yazilir ve blogun
+ * BW_RATE'i gercek hizi yansitmaz; bu bloklar atlanir.
+ */
+private void pedometer_block_cb( const struct zbus_channel *chan )
+{
+    const struct adxl345_block *block = zbus_chan_const_msg(chan);
+    struct adxl345_sample mg[ADXL345_FIFO_DEPTH];
+
+    if (!live_enabled || live_suspended) {
+        return;
+    }
+
+    uint8_t shift = adxl345_lsb_shift(block->data_format);
+
+    for (int i = 0; i < block->count; i++) {
+        mg[i].x = adxl345_lsb_to_mg(block->samples[i].x, shift);
+        mg[i].y = adxl345_lsb_to_mg(block->samples[i].y, shift);
+        mg[i].z = adxl345_lsb_to_mg(block->samples[i].z, shift);
+    }
+
+    k_mutex_lock(&live_lock, K_FOREVER);
+    pedometer_feed_mg(&live, mg, block->count, adxl345_odr_mhz(block->bw_rate));
+    k_mutex_unlock(&live_lock);
+}
+
+/**
+ * @brief Inaktivitede motoru duraklatir, aktivitede yeniden baslatir.
+ */
+private void pedometer_event_cb( const struct zbus_channel *chan )
+{
+    const struct adxl345_event *event = zbus_chan_const_msg(chan);
+
+    if (event->source & ADXL_INT_SOURCE_INACTIVITY) {
+        k_mutex_lock(&live_lock, K_FOREVER);
+        pedometer_pause(&live);
+        k_mutex_unlock(&live_lock);
+        live_suspended = true;
+    }
+    if (event->source & ADXL_INT_SOURCE_ACTIVITY) {
+        live_suspended = false;
+    }
+}
+
+ZBUS_LISTENER_DEFINE(pedometer_block_listener, pedometer_block_cb);
+ZBUS_CHAN_ADD_OBS(adxl_block_chan, pedometer_block_listener, 2);
+
+ZBUS_LISTENER_DEFINE(pedometer_event_listener, pedometer_event_cb);
+ZBUS_CHAN_ADD_OBS(adxl_event_chan, pedometer_event_listener, 2);
+
+
+/**
+ * @brief Adim sayari baslatir: pipeline dusuk guclu 25 Hz ve 1 s watermark ile calisir.
+ *
+ * @return Basariliysa 0, aksi halde hata kodu.
+ */
+public int pedometer_start(void)
+{
+    live_suspended = false;
+    live_enabled = true;
+
+    int err = sample_pipeline_start(PEDOMETER_BW_RATE, PEDOMETER_WATERMARK);
+    if (err) {
+        live_enabled = false;
+        LOG_ERROR("[%s]: Adim sayar baslatilamadi! Hata Kodu: %d", __func__, err);
+    }
+    return err;
+}
+
+/**
+ * @brief Canli adim sayisini ve kadansi okur.
+ */
+public void pedometer_get(struct pedometer_info *info)
+{
+    k_mutex_lock(&live_lock, K_FOREVER);
+    info->steps = live.steps;
+    info->cadence_spm = pedometer_cadence(&live);
+    k_mutex_unlock(&live_lock);
+}
+
+/**
+ * @brief Canli adim sayarini sifirlar.
+ */
+public void pedometer_reset(void)
+{
+    k_mutex_lock(&live_lock, K_FOREVER);
+    pedometer_init(&live);
+    k_mutex_unlock(&live_lock);
+}
+
+
+#if defined(CONFIG_SHELL)
+#include <zephyr/shell/shell.h>
+
+/** @brief Benchmark izlerinin ornekleme hizi (mHz) ve suresi (s) */
+#define PED_BENCH_ODR_MHZ       25000U
+#define PED_BENCH_DURATION_S    120U
+
+/**
+ * @brief Sentetik bir ivme izi tanimi.
+ *
+ * Yurume izlerinde dikey eksen adim frekansinda ve iki katinda bilesen,
+ * yanal eksen adim frekansinin yarisinda salinim (govde salinimi) icerir.
+ * Yurume olmayan izler yanlis pozitif kontrolu icindir.
+ */
+struct ped_trace {
+    const char *name;
+    uint16_t cadence_spm;       /*!< Adim/dk; 0 ise duzensiz sarsinti uretilir   */
+    uint16_t amplitude_mg;      /*!< Dikey salinim genligi                       */
+    uint16_t noise_mg;          /*!< Her eksene eklenen gurultu genligi          */
+};
+
+static const struct ped_trace ped_traces[] = {
+    { "yavas yurume",   80,  250, 40 },
+    { "normal yurume", 110,  400, 60 },
+    { "hizli yurume",  140,  600, 80 },
+    { "kosu",          170, 1200, 120 },
+    { "masada",          0,    0, 20 },
+    { "sarsinti",        0,  900, 40 },
+};
+
+/**
+ * @brief Tekrarlanabilir gurultu icin dogrusal esliksiz uretec (LCG).
+ */
+private int32_t bench_noise(uint32_t *state, uint16_t amplitude)
+{
+    *state = *state * 1664525U + 1013904223U;
+    if (amplitude == 0) {
+        return 0;
+    }
+    return (int32_t)((*state >> 16) % (2U * amplitude + 1U)) - amplitude;
+}
+
+/**
+ * @brief Izin n. ornegini uretir.
+ *
+ * Sarsinti izinde 2.5..4 s arayla tekil, 120 ms suren darbeler uretilir;
+ * araliklar gecerli adim araligindan uzun oldugu icin sayilmamalidir.
+ */
+private void bench_sample(const struct ped_trace *trace, uint32_t n, uint32_t *rng,
+                          uint32_t *next_jolt, struct adxl345_sample *out)
+{
+    int32_t x = 0, y = 0, z = 1000;
+
+    if (trace->cadence_spm) {
+        /* Faz: 65536 = bir adim */
+        uint64_t phase = ((uint64_t)n * trace->cadence_spm * 65536U * 1000U) / (60U * PED_BENCH_ODR_MHZ);
+
+        z += (trace->amplitude_mg * fx_sin_q15((uint16_t)phase)) >> 15;
+        z += ((trace->amplitude_mg / 3) * fx_sin_q15((uint16_t)(2 * phase + 10923))) >> 15;
+        x += ((trace->amplitude_mg / 4) * fx_sin_q15((uint16_t)(phase / 2))) >> 15;
+    } else if (trace->amplitude_mg) {
+        if (n >= *next_jolt) {
+            z += (n - *next_jolt < 3) ? trace->amplitude_mg : 0;
+            if (n - *next_jolt >= 3) {
+                *next_jolt = n + 62 + (*rng >> 8) % 38;
+            }
+        }
+    }
+
+    out->x = (int16_t)(x + bench_noise(rng, trace->noise_mg));
+    out->y = (int16_t)(y + bench_noise(rng, trace->noise_mg));
+    out->z = (int16_t)(z + bench_noise(rng, trace->noise_mg));
+}
+
+/**
+ * @brief Sentetik izleri ayri motor orneklerinden gecirir; beklenen adim sayisina
+ *        gore hata oranini ve islem hizini raporlar.
+ */
+private int cmd_steps_bench(const struct shell *sh, size_t argc, char **argv)
+{
+    struct adxl345_sample block[PEDOMETER_WATERMARK];
+    const uint32_t total = PED_BENCH_DURATION_S * (PED_BENCH_ODR_MHZ / 1000U);
+
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    shell_print(sh, "%-14s %8s %8s %7s %7s %10s", "iz", "beklenen", "sayilan", "hata", "kadans", "ornek/s");
+
+    for (size_t t = 0; t < ARRAY_SIZE(ped_traces); t++) {
+        const struct ped_trace *trace = &ped_traces[t];
+        struct pedometer ped;
+        uint32_t rng = 12345U + t;
+        uint32_t next_jolt = 50;
+        uint64_t cycles = 0;
+
+        pedometer_init(&ped);
+
+        for (uint32_t n = 0; n < total; n += PEDOMETER_WATERMARK) {
+            for (int i = 0; i < PEDOMETER_WATERMARK; i++) {
+                bench_sample(trace, n + i, &rng, &next_jolt, &block[i]);
+            }
+
+            uint32_t start = k_cycle_get_32();
+            pedometer_feed_mg(&ped, block, PEDOMETER_WATERMARK, PED_BENCH_ODR_MHZ);
+            cycles += k_cycle_get_32() - start;
+        }
+
+        uint32_t expected = (trace->cadence_spm * PED_BENCH_DURATION_S) / 60U;
+        uint32_t diff = (ped.steps > expected) ? ped.steps - expected : expected - ped.steps;
+        uint32_t err_permille = expected ? (diff * 1000U) / expected : diff * 1000U;
+        uint64_t ns = k_cyc_to_ns_floor64(cycles);
+        uint64_t rate = ns ? ((uint64_t)total * 1000000000ULL) / ns : 0;
+
+        shell_print(sh, "%-14s %8u %8u %5u.%u%% %7u %10llu", trace->name, expected, ped.steps,
+                    err_permille / 10, err_permille % 10, pedometer_cadence(&ped), rate);
+    }
+    return 0;
+}
+
+private int cmd_steps_show(const struct shell *sh, size_t argc, char **argv)
+{
+    struct pedometer_info info;
+
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    pedometer_get(&info);
+    shell_print(sh, "adim: %u, kadans: %u adim/dk%s", info.steps, info.cadence_spm,
+                live_suspended ? " (uyku)" : "");
+    return 0;
+}
+
+private int cmd_steps_reset(const struct shell *sh, size_t argc, char **argv)
+{
+    ARG_UNUSED(sh);
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    pedometer_reset();
+    return 0;
+}
+
+private int cmd_steps_start(const struct shell *sh, size_t argc, char **argv)
+{
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    int err = pedometer_start();
+    if (err) {
+        shell_error(sh, "Baslatilamadi: %d", err);
+    }
+    return err;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_steps,
+    SHELL_CMD_ARG(show,  NULL, "Adim sayisi ve kadans",                cmd_steps_show,  1, 0),
+    SHELL_CMD_ARG(reset, NULL, "Adim sayisini sifirla",                cmd_steps_reset, 1, 0),
+    SHELL_CMD_ARG(start, NULL, "Pipeline'i 25 Hz dusuk guc ile baslat", cmd_steps_start, 1, 0),
+    SHELL_CMD_ARG(bench, NULL, "Sentetik izlerle dogruluk ve hiz",     cmd_steps_bench, 1, 0),
+    SHELL_SUBCMD_SET_END
+);
+
+SHELL_SUBCMD_ADD((adxl), steps, &sub_steps, "Adim sayar", NULL, 0, 0);
+#endif
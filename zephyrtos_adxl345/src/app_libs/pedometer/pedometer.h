@@ -0,0 +1,90 @@
+/**
+ * @file pedometer.h
+ * @brief FIFO bloklari ile calisan dusuk guclu adim sayar
+ *
+ * Ivme buyuklugu filtrelenir (yercekimi bileseni cikarilir, hareketli ortalama),
+ * uyarlanabilir esik ile tepe tespiti yapilir ve adim araliklari kadans
+ * sinirlari icinde dogrulanir. Ardisik PEDOMETER_REGULATION_STEPS gecerli adim
+ * gorulmeden sayac artmaz; boylece tekil sarsintilar adim sayilmaz.
+ *
+ * CPU yalnizca FIFO watermark hizinda uyanir (varsayilan 25 Hz ODR, 25 ornek
+ * watermark: saniyede bir). Sensor link + auto-sleep ile uykuya gectiginde
+ * motor duraklatilir; adim sayisi korunur, uyanista filtreler yeniden baslar.
+ */
+#ifndef PEDOMETER_H
+#define PEDOMETER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "adxl345.h"
+
+/** @brief Adim sayar icin ornekleme hizi (LOW_POWER ile) */
+#define PEDOMETER_BW_RATE               (ADXL_BW_RATE_25HZ | ADXL_BW_RATE_LOW_POWER)
+
+/** @brief FIFO watermark'i (ornek); 25 Hz'de saniyede bir uyanma */
+#define PEDOMETER_WATERMARK             25
+
+/** @brief Yercekimi (DC) takibi icin ustel ortalama katsayisi (1/2^n) */
+#define PEDOMETER_BASELINE_SHIFT        5
+
+/** @brief Yumusatma icin hareketli ortalama uzunlugu (2'nin kuvveti) */
+#define PEDOMETER_SMOOTH_LEN            4
+
+/** @brief Uyarlanabilir esigin yenilendigi pencere (ornek) */
+#define PEDOMETER_THRESH_WINDOW         50
+
+/** @brief Adim sayilabilmesi icin gereken en kucuk tepe-tepe genlik (mg) */
+#define PEDOMETER_MIN_P2P_MG            120
+
+/** @brief Gecerli adim araligi siniri (ms): 30..240 adim/dk */
+#define PEDOMETER_MIN_INTERVAL_MS       250
+#define PEDOMETER_MAX_INTERVAL_MS       2000
+
+/** @brief Saymaya baslamak icin gereken ardisik gecerli adim sayisi */
+#define PEDOMETER_REGULATION_STEPS      4
+
+/** @brief Adim sayar motorunun durumu */
+struct pedometer {
+    int32_t baseline_q;         /*!< Buyukluk ortalamasi (PEDOMETER_BASELINE_SHIFT kesirli)  */
+    int32_t smooth[PEDOMETER_SMOOTH_LEN];
+    int32_t smooth_sum;
+    uint8_t smooth_pos;
+    bool primed;                /*!< Filtreler ilk ornekle baslatildi mi                     */
+    bool above;                 /*!< Sinyal esigin ustunde mi                                */
+    bool counting;              /*!< Kadans dogrulandi, adimlar sayiliyor                    */
+    uint8_t regulation;         /*!< Dogrulama bekleyen ardisik adim sayisi                  */
+
+    int32_t win_max;
+    int32_t win_min;
+    uint16_t win_count;
+    int32_t threshold;          /*!< Uyarlanabilir esik (mg)                                 */
+    int32_t p2p;                /*!< Son pencerenin tepe-tepe genligi (mg)                   */
+
+    uint64_t time_us;           /*!< Ornek sayacindan hesaplanan zaman                       */
+    uint64_t last_step_us;
+    uint32_t interval_avg_ms;   /*!< Adim araligi ortalamasi                                 */
+    uint32_t steps;             /*!< Toplam adim                                             */
+};
+
+/** @brief Disariya sunulan adim sayar bilgisi */
+struct pedometer_info {
+    uint32_t steps;             /*!< Toplam adim                                             */
+    uint16_t cadence_spm;       /*!< Kadans (adim/dk), yurume yoksa 0                        */
+};
+
+public void pedometer_init(struct pedometer *ped);
+public void pedometer_pause(struct pedometer *ped);
+public void pedometer_feed_mg(struct pedometer *ped, const struct adxl345_sample *mg, uint32_t count, uint32_t odr_mhz);
+public uint16_t pedometer_cadence(const struct pedometer *ped);
+
+public int pedometer_start(void);
+public void pedometer_get(struct pedometer_info *info);
+public void pedometer_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PEDOMETER_H
@@ -0,0 +1,316 @@
+#include "sample_pipeline.h"
+#include "gpio_settings.h"
+#include "spi_bus.h"
+#include "impact.h"
+#include "utils.h"
+#include <zephyr/kernel.h>
+
+LOG_MODULE_REGISTER(sample_pipeline, LOG_LEVEL_INF);
+
+
+extern struct k_sem adxl_data_semaphore;
+extern struct k_sem adxl_int_semaphore;
+
+
+ZBUS_CHAN_DEFINE(adxl_block_chan,
+                 struct adxl345_block,
+                 NULL,
+                 NULL,
+                 ZBUS_OBSERVERS_EMPTY,
+                 ZBUS_MSG_INIT(0));
+
+ZBUS_CHAN_DEFINE(adxl_event_chan,
+                 struct adxl345_event,
+                 NULL,
+                 NULL,
+                 ZBUS_OBSERVERS_EMPTY,
+                 ZBUS_MSG_INIT(0));
+
+static struct adxl345_sample block_buf[ADXL345_FIFO_DEPTH];
+static uint32_t block_seq;
+static uint8_t pipeline_bw_rate;
+static uint8_t pipeline_data_format;
+static uint32_t pipeline_deadline_us;
+static bool pipeline_running;
+
+
+/**
+ * @brief Bosaltilan blogu tuketicilere yayinlar.
+ *
+ * Listener'lar bu fonksiyon icinden, event loop thread'inde senkron cagrilir;
+ * `block_buf` bir sonraki bosaltmaya kadar degismez. SPI hatti bu noktada
+ * birakilmis olur; listener'larin islem suresi hatti mesgul etmez.
+ *
+ * `data_format`, bosaltmanin hat oturumunda alinan degerdir. LSB agirligini
+ * degistiren bir DATA_FORMAT yazimi surucunun FIFO'yu atmasina yol acar; bu
+ * yuzden onceki bloktan farkli bir agirlik, aradaki orneklerin kayboldugunu
+ * gosterir ve `overrun` kurulur. Yalnizca range'in degistigi FULL_RES
+ * gecislerinde ornek kaybi yoktur.
+ */
+private void publish_block(uint8_t count, uint8_t data_format, bool overrun)
+{
+    overrun |= adxl345_lsb_shift(data_format) != adxl345_lsb_shift(pipeline_data_format);
+    pipeline_data_format = data_format;
+
+    struct adxl345_block block = {
+        .samples     = block_buf,
+        .count       = count,
+        .bw_rate     = pipeline_bw_rate,
+        .data_format = data_format,
+        .overrun     = overrun,
+        .seq         = block_seq++,
+        .timestamp   = k_uptime_get_32(),
+    };
+
+    int err = zbus_chan_pub(&adxl_block_chan, &block, K_MSEC(SAMPLE_PIPELINE_PUB_TIMEOUT_MS));
+    if (err) {
+        LOG_WARNING("[%s]: Blok yayinlanamadi: %d", __func__, err);
+    }
+}
+
+/**
+ * @brief Aktivite/inaktivite bitlerini iceren bir INT_SOURCE degerini yayinlar.
+ */
+private void publish_motion_event(uint8_t source)
+{
+    source &= ADXL_INT_SOURCE_ACTIVITY | ADXL_INT_SOURCE_INACTIVITY;
+    if (!source) {
+        return;
+    }
+
+    struct adxl345_event event = {
+        .source     = source,
+        .timestamp  = k_uptime_get_32(),
+    };
+
+    zbus_chan_pub(&adxl_event_chan, &event, K_MSEC(SAMPLE_PIPELINE_PUB_TIMEOUT_MS));
+}
+
+/**
+ * @brief Bir FIFO bosaltmasinin sonucunu raporlar ve blogu yayinlar.
+ */
+private void finish_drain( int count , uint8_t data_format , bool overrun )
+{
+    if (overrun) {
+        LOG_WARNING("[%s]: FIFO tasmasi, ornek kaybi olustu", __func__);
+    }
+    if (count < 0) {
+        LOG_ERROR("[%s]: FIFO okunamadi! Hata Kodu: %d", __func__, count);
+    } else if (count > 0) {
+        publish_block(count, data_format, overrun);
+    }
+}
+
+/**
+ * @brief Olay pininden (tek pinli yapilandirmada tek pinden) gelen interrupt'u servis eder.
+ *
+ * INT_SOURCE okunur, aktivite/inaktivite olaylari gpio_settings modulune
+ * iletilir. Tek pinli yapilandirmada watermark veya overrun varsa FIFO da
+ * bosaltilir; pin kenar tetiklemeli oldugu icin bosaltma sirasinda yeniden
+ * dolan FIFO'nun kacirilmamasi amaciyla INT_SOURCE sinirli sayida yeniden
+ * okunur. Ayri veri pini varsa (ADXL_INT_SPLIT) FIFO burada bosaltilmaz.
+ *
+ * Tur siniri dolarsa (listener'lar bir FIFO suresinden uzun surdugunde, ornegin
+ * 3200 Hz'de) veya servis sirasinda yeni bir kaynak olusursa pin aktif kalir ve
+ * yeni kenar gelmez. Bu yuzden cikista pin seviyesi okunur; aktifse semafor
+ * yeniden verilir ve pin event loop'un bir sonraki turunda servis edilir.
+ *
+ * INT_SOURCE okuma ve FIFO bosaltma tek bir RT sinifi hat oturumunda yapilir;
+ * deadline, watermark'tan FIFO tasmasina kadar kalan suredir.
+ *
+ * Event loop tarafindan `adxl_int_semaphore` alindiginda cagrilir; interrupt
+ * handler yalnizca semafor verir, SPI erisimi burada yapilir.
+ */
+public void sample_pipeline_service(void)
+{
+    const struct adxl345_bus *bus = adxl345_get_bus();
+
+    for (int round = 0; round < SAMPLE_PIPELINE_MAX_ROUNDS; round++) {
+        uint8_t source;
+        uint8_t data_format = 0;
+        int count = 0;
+
+        spi_bus_acquire(bus, SPI_BUS_CLASS_RT, pipeline_deadline_us);
+        int err = read_interrupt_source(&source);
+        bool drain = !ADXL_INT_SPLIT && !err && pipeline_running &&
+                     (source & (ADXL_INT_SOURCE_WATERMARK | ADXL_INT_SOURCE_OVERRUN));
+        if (drain) {
+            count = adxl345_read_fifo(block_buf, ARRAY_SIZE(block_buf));
+            data_format = adxl345_fifo_data_format();
+        }
+        spi_bus_release();
+
+        if (err) {
+            return;
+        }
+
+        handle_motion_event(source);
+        publish_motion_event(source);
+
+        if (!drain) {
+            break;
+        }
+        finish_drain(count, data_format, source & ADXL_INT_SOURCE_OVERRUN);
+    }
+
+    if (adxl_event_pin_active()) {
+        k_sem_give(&adxl_int_semaphore);
+    }
+}
+
+/**
+ * @brief Veri pininden gelen interrupt'u servis eder (yalnizca ADXL_INT_SPLIT).
+ *
+ * Veri pinine yalnizca DATA_READY, WATERMARK ve OVERRUN eslendigi icin
+ * INT_SOURCE okunmaz; FIFO dogrudan bosaltilir ve interrupt basina bir hat
+ * islemi kazanilir. Bosaltma sonrasi pin hala aktifse FIFO watermark'i yeniden
+ * asmistir; bu hat erisimi olmadan pin seviyesinden anlasilir ve FIFO yeniden
+ * okunur.
+ *
+ * Tur siniri dolarken pin hala aktifse semafor yeniden verilir; pin kenar
+ * tetiklemeli oldugu icin aksi halde toplama durur.
+ *
+ * OVERRUN biti okunmadigi icin FIFO'nun dolu (32 ornek) bulunmasi tasma kabul
+ * edilir; watermark 31 iken tasmadan hemen once yapilan bir bosaltma da
+ * tasma olarak isaretlenebilir.
+ *
+ * Event loop tarafindan `adxl_data_semaphore` alindiginda cagrilir.
+ */
+public void sample_pipeline_service_data(void)
+{
+    const struct adxl345_bus *bus = adxl345_get_bus();
+
+    for (int round = 0; round < SAMPLE_PIPELINE_MAX_ROUNDS; round++) {
+        if (!pipeline_running) {
+            return;
+        }
+
+        spi_bus_acquire(bus, SPI_BUS_CLASS_RT, pipeline_deadline_us);
+        int count = adxl345_read_fifo(block_buf, ARRAY_SIZE(block_buf));
+        uint8_t data_format = adxl345_fifo_data_format();
+        spi_bus_release();
+
+        finish_drain(count, data_format, count == (int)ARRAY_SIZE(block_buf));
+        if (count < 0 || !adxl_data_pin_active()) {
+            return;
+        }
+    }
+
+    k_sem_give(&adxl_data_semaphore);
+}
+
+
+/**
+ * @brief Stream modunda FIFO toplamayi baslatir.
+ *
+ * Veri hizi ayarlanir, FIFO stream moduna alinir ve watermark interrupt'u
+ * etkinlestirilir. Watermark'in eslendigi pin init sirasinda INT_MAP'e
+ * yazilmistir (ADXL_INT_MAP_ROUTE).
+ *
+ * @param bw_rate   ADXL_BW_RATE_* degeri.
+ * @param watermark Interrupt uretilecek FIFO doluluk seviyesi (1..31).
+ * @return Basariliysa 0, darbe kaydi kuruluysa -EBUSY, aksi halde hata kodu.
+ */
+public int sample_pipeline_start(uint8_t bw_rate, uint8_t watermark)
+{
+    int err;
+
+    if (watermark == 0 || watermark > ADXL_FIFO_CTL_SAMPLES_MASK) {
+        return -EINVAL;
+    }
+    if (impact_is_armed()) {
+        return -EBUSY;
+    }
+
+    err = adxl345_update_reg(ADXL345_INT_ENABLE, ADXL_INT_ENABLE_WATERMARK, 0);
+    if (!err) {
+        err = adxl345_set_bw_rate(bw_rate);
+    }
+    if (!err) {
+        err = adxl345_fifo_configure(ADXL_FIFO_CTL_MODE_STREAM | watermark);
+    }
+    if (err) {
+        LOG_ERROR("[%s]: FIFO yapilandirilamadi! Hata Kodu: %d", __func__, err);
+        return err;
+    }
+
+    pipeline_bw_rate = bw_rate;
+    pipeline_data_format = adxl345_fifo_data_format();
+    pipeline_deadline_us = (uint32_t)(((uint64_t)(ADXL345_FIFO_DEPTH - watermark) * 1000000000ULL) /
+                                      adxl345_odr_mhz(bw_rate));
+    pipeline_running = true;
+
+    err = adxl345_update_reg(ADXL345_INT_ENABLE, ADXL_INT_ENABLE_WATERMARK, ADXL_INT_ENABLE_WATERMARK);
+    if (err) {
+        pipeline_running = false;
+        return err;
+    }
+
+    LOG_INFO("[%s]: FIFO toplama basladi (BW_RATE=0x%02X, watermark=%u)", __func__, bw_rate, watermark);
+    return 0;
+}
+
+/**
+ * @brief FIFO toplamayi durdurur ve FIFO'yu bypass moduna alir.
+ *
+ * @return Basariliysa 0, aksi halde hata kodu.
+ */
+public int sample_pipeline_stop(void)
+{
+    int err = adxl345_update_reg(ADXL345_INT_ENABLE, ADXL_INT_ENABLE_WATERMARK, 0);
+
+    pipeline_running = false;
+    if (!err) {
+        err = adxl345_fifo_configure(ADXL_FIFO_CTL_MODE_BYPASS);
+    }
+    return err;
+}
+
+public bool sample_pipeline_is_running(void)
+{
+    return pipeline_running;
+}
+
+
+#if defined(CONFIG_SHELL)
+#include <zephyr/shell/shell.h>
+
+private int cmd_pipeline_start(const struct shell *sh, size_t argc, char **argv)
+{
+    int err = 0;
+    unsigned long rate = shell_strtoul(argv[1], 0, &err);
+    unsigned long watermark = shell_strtoul(argv[2], 0, &err);
+
+    ARG_UNUSED(argc);
+    if (err || rate > UINT8_MAX || watermark > UINT8_MAX) {
+        shell_error(sh, "Gecersiz arguman");
+        return -EINVAL;
+    }
+
+    err = sample_pipeline_start(rate, watermark);
+    if (err) {
+        shell_error(sh, "Baslatilamadi: %d", err);
+    }
+    return err;
+}
+
+private int cmd_pipeline_stop(const struct shell *sh, size_t argc, char **argv)
+{
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    int err = sample_pipeline_stop();
+    if (err) {
+        shell_error(sh, "Durdurulamadi: %d", err);
+    }
+    return err;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_pipeline,
+    SHELL_CMD_ARG(start, NULL, "FIFO toplama: start <bw_rate> <watermark>", cmd_pipeline_start, 3, 0),
+    SHELL_CMD_ARG(stop,  NULL, "FIFO toplamayi durdur",                     cmd_pipeline_stop,  1, 0),
+    SHELL_SUBCMD_SET_END
+);
+
+SHELL_SUBCMD_ADD((adxl), pipeline, &sub_pipeline, "FIFO ornek pipeline'i", NULL, 0, 0);
+#endif
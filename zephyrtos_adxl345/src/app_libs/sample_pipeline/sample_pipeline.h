@@ -0,0 +1,70 @@
+/**
+ * @file sample_pipeline.h
+ * @brief ADXL345 FIFO toplama ve ornek bloklarinin dagitimi
+ *
+ * Sensor stream modunda FIFO'ya ornek biriktirir; watermark interrupt'u
+ * geldiginde FIFO tek seferde bosaltilir ve blok `adxl_block_chan` zbus
+ * kanali uzerinden tuketicilere (listener) yayinlanir. Aktivite/inaktivite
+ * olaylari `adxl_event_chan` kanalina yayinlanir.
+ *
+ * @author uzunberkay
+ */
+#ifndef SAMPLE_PIPELINE_H
+#define SAMPLE_PIPELINE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "adxl345.h"
+#include <zephyr/zbus/zbus.h>
+
+/**
+ * @brief Tek bir servis cagrisinda FIFO'nun (tek pinde INT_SOURCE ile) en fazla kac kez yeniden kontrol edilecegi.
+ * Sinir dolarken pin hala aktifse servis bir sonraki event loop turuna ertelenir.
+ */
+#define SAMPLE_PIPELINE_MAX_ROUNDS      4
+
+/** @brief Blok yayinlama zaman asimi (ms) */
+#define SAMPLE_PIPELINE_PUB_TIMEOUT_MS  10
+
+/**
+ * @brief FIFO'dan bir seferde okunan ornek blogu.
+ *
+ * `samples` pipeline'in tamponunu gosterir ve yalnizca listener geri
+ * cagirmasi suresince gecerlidir; saklanmasi gereken veri kopyalanmalidir.
+ */
+struct adxl345_block {
+    const struct adxl345_sample *samples;   /*!< Ham ornekler (LSB)                 */
+    uint8_t count;                          /*!< Bloktaki ornek sayisi              */
+    uint8_t bw_rate;                        /*!< Orneklerin alindigi BW_RATE        */
+    uint8_t data_format;                    /*!< Orneklerin alindigi DATA_FORMAT    */
+    bool overrun;                           /*!< Bu bloktan once ornek kaybedildi (tasma veya LSB agirligi degisimi) */
+    uint32_t seq;                           /*!< Blok sira numarasi                 */
+    uint32_t timestamp;                     /*!< FIFO'nun bosaltildigi an (ms)      */
+};
+
+/**
+ * @brief INT_SOURCE'tan ayrilan aktivite/inaktivite olayi.
+ *
+ * Link + auto-sleep ayarinda inaktivite olayi sensorun uykuya (8 Hz'e kadar
+ * dusuk ornekleme) gectigini, aktivite olayi normal ODR'ye dondugunu gosterir.
+ */
+struct adxl345_event {
+    uint8_t source;                         /*!< ACTIVITY ve/veya INACTIVITY bitleri */
+    uint32_t timestamp;                     /*!< Olayin islendigi an (ms)            */
+};
+
+ZBUS_CHAN_DECLARE(adxl_block_chan, adxl_event_chan);
+
+public void sample_pipeline_service(void);
+public void sample_pipeline_service_data(void);
+public int sample_pipeline_start(uint8_t bw_rate, uint8_t watermark);
+public int sample_pipeline_stop(void);
+public bool sample_pipeline_is_running(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SAMPLE_PIPELINE_H
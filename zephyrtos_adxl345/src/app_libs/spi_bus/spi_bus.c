@@ -0,0 +1,294 @@
+#include "spi_bus.h"
+#include <limits.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/slist.h>
+
+LOG_MODULE_REGISTER(spi_bus, LOG_LEVEL_INF);
+
+
+/** @brief Hatti bekleyen bir istek; bekleyen thread'in yigininda durur */
+struct spi_bus_waiter {
+    sys_snode_t node;
+    struct k_sem granted;
+    k_tid_t thread;
+    int prio;
+    const void *dev;
+    enum spi_bus_class cls;
+    uint32_t deadline_us;
+    uint32_t request_cycles;
+};
+
+/** @brief Hatti tutan oturum */
+struct spi_bus_session {
+    k_tid_t owner;
+    int base_prio;
+    bool boosted;
+    uint8_t depth;
+    enum spi_bus_class cls;
+    uint32_t deadline_us;
+    uint32_t request_cycles;
+    uint32_t grant_cycles;
+};
+
+static struct k_spinlock bus_lock;
+static sys_slist_t wait_queue[SPI_BUS_CLASS_COUNT];
+static struct spi_bus_session session;
+static enum spi_bus_policy bus_policy;
+
+static const void *last_dev;
+static uint8_t batch_run;
+
+static struct spi_bus_class_stats bus_stats[SPI_BUS_CLASS_COUNT];
+
+
+/**
+ * @brief Hatti bir istege verir. bus_lock tutulurken cagrilir.
+ */
+private void grant( k_tid_t thread , const void *dev , enum spi_bus_class cls ,
+                    uint32_t deadline_us , uint32_t request_cycles )
+{
+    if (dev != last_dev) {
+        bus_stats[cls].switches++;
+    }
+
+    session.owner = thread;
+    session.base_prio = k_thread_priority_get(thread);
+    session.boosted = false;
+    session.depth = 1;
+    session.cls = cls;
+    session.deadline_us = deadline_us;
+    session.request_cycles = request_cycles;
+    session.grant_cycles = k_cycle_get_32();
+
+    batch_run = (dev == last_dev) ? batch_run + 1 : 0;
+    last_dev = dev;
+}
+
+/**
+ * @brief Siradaki istegi secer ve kuyruktan cikarir. bus_lock tutulurken cagrilir.
+ *
+ * En yuksek oncelikli dolu kuyruk secilir. Kuyrukta son islemle ayni
+ * chip-select'e giden bir istek varsa ve batch siniri asilmadiysa o istek
+ * one alinir; aksi halde kuyrugun basindaki istek (gelis sirasi) secilir.
+ * FIFO politikasinda tum istekler tek kuyruktadir ve batching yapilmaz.
+ *
+ * @param[out] batched  Istek ayni CS nedeniyle one alindiysa true.
+ * @return Secilen istek veya kuyruklar bossa NULL.
+ */
+private struct spi_bus_waiter *pick_next( bool *batched )
+{
+    for (int q = 0; q < SPI_BUS_CLASS_COUNT; q++) {
+        sys_snode_t *prev = NULL;
+        sys_snode_t *node;
+        struct spi_bus_waiter *head = NULL;
+
+        SYS_SLIST_FOR_EACH_NODE(&wait_queue[q], node) {
+            struct spi_bus_waiter *waiter = CONTAINER_OF(node, struct spi_bus_waiter, node);
+
+            if (!head) {
+                head = waiter;
+            }
+            if (bus_policy == SPI_BUS_POLICY_PRIORITY &&
+                waiter->dev == last_dev && batch_run < SPI_BUS_BATCH_MAX) {
+                *batched = (waiter != head);
+                sys_slist_remove(&wait_queue[q], prev, node);
+                return waiter;
+            }
+            prev = node;
+        }
+
+        if (head) {
+            *batched = false;
+            sys_slist_get(&wait_queue[q]);
+            return head;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Hatti tutan thread'in onceligini en az `prio` yapar. bus_lock tutulurken cagrilir.
+ *
+ * Spinlock tutulurken kesmeler kapali oldugu icin k_thread_priority_set()
+ * burada thread degistirmez; yeni oncelik bir sonraki zamanlama noktasinda
+ * (bekleyenin k_sem_take'i) gecerli olur.
+ */
+private void inherit_priority( int prio )
+{
+    if (prio >= k_thread_priority_get(session.owner)) {
+        return;
+    }
+    k_thread_priority_set(session.owner, prio);
+    if (!session.boosted) {
+        session.boosted = true;
+        bus_stats[session.cls].boosted++;
+    }
+}
+
+/**
+ * @brief Kuyruklarda bekleyen en yuksek thread onceligini dondurur. bus_lock tutulurken cagrilir.
+ */
+private int highest_waiting_priority( void )
+{
+    int prio = INT_MAX;
+    sys_snode_t *node;
+
+    for (int q = 0; q < SPI_BUS_CLASS_COUNT; q++) {
+        SYS_SLIST_FOR_EACH_NODE(&wait_queue[q], node) {
+            prio = MIN(prio, CONTAINER_OF(node, struct spi_bus_waiter, node)->prio);
+        }
+    }
+    return prio;
+}
+
+/**
+ * @brief Biten oturumu istatistiklere ekler. bus_lock tutulurken cagrilir.
+ */
+private void account_session( uint32_t now )
+{
+    struct spi_bus_class_stats *stats = &bus_stats[session.cls];
+    uint32_t wait = session.grant_cycles - session.request_cycles;
+    uint32_t total = now - session.request_cycles;
+
+    stats->sessions++;
+    stats->total_cycles += total;
+    if (wait > stats->max_wait_cycles) {
+        stats->max_wait_cycles = wait;
+    }
+    if (total > stats->max_total_cycles) {
+        stats->max_total_cycles = total;
+    }
+    if (session.deadline_us && total > k_us_to_cyc_ceil32(session.deadline_us)) {
+        stats->deadline_miss++;
+    }
+}
+
+/**
+ * @brief Hatti verilen oncelik sinifi ile alir; hat mesgulse sirasi gelene kadar bekler.
+ *
+ * Hatti zaten tutan thread tekrar cagirirsa ic ice sayac artar ve hemen doner;
+ * ic ice oturumlar dis oturumun sinifini ve deadline'ini kullanir. Her basarili
+ * cagri bir spi_bus_release() ile kapatilmalidir. Beklemek zorunda kalan
+ * thread'in onceligi sahibinkinden yuksekse sahip bu oncelige yukseltilir.
+ *
+ * @param dev           Islemin gidecegi cihaz (batching icin chip-select kimligi;
+ *                      ornegin adxl345_get_bus()).
+ * @param cls           Oncelik sinifi.
+ * @param deadline_us   Istekten birakmaya kadar izin verilen sure; 0 ise deadline yok.
+ * @return Basariliysa 0, interrupt baglaminda cagrilirsa -EWOULDBLOCK.
+ */
+public int spi_bus_acquire(const void *dev, enum spi_bus_class cls, uint32_t deadline_us)
+{
+    uint32_t request_cycles = k_cycle_get_32();
+    k_tid_t self = k_current_get();
+
+    if (k_is_in_isr()) {
+        return -EWOULDBLOCK;
+    }
+    if (cls >= SPI_BUS_CLASS_COUNT) {
+        cls = SPI_BUS_CLASS_NORMAL;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&bus_lock);
+
+    if (session.owner == self) {
+        session.depth++;
+        k_spin_unlock(&bus_lock, key);
+        return 0;
+    }
+    if (session.owner == NULL) {
+        grant(self, dev, cls, deadline_us, request_cycles);
+        k_spin_unlock(&bus_lock, key);
+        return 0;
+    }
+
+    struct spi_bus_waiter waiter = {
+        .thread         = self,
+        .prio           = k_thread_priority_get(self),
+        .dev            = dev,
+        .cls            = cls,
+        .deadline_us    = deadline_us,
+        .request_cycles = request_cycles,
+    };
+
+    k_sem_init(&waiter.granted, 0, 1);
+    sys_slist_append(&wait_queue[bus_policy == SPI_BUS_POLICY_FIFO ? 0 : cls], &waiter.node);
+    bus_stats[cls].contended++;
+    inherit_priority(waiter.prio);
+    k_spin_unlock(&bus_lock, key);
+
+    /* Hat, birakan thread tarafindan bu istege devredilir */
+    k_sem_take(&waiter.granted, K_FOREVER);
+    return 0;
+}
+
+/**
+ * @brief Hatti birakir; bekleyen varsa hatti siradaki istege devreder.
+ *
+ * Sahibin onceligi yukseltildiyse eski degerine dondurulur. Yeni sahip, geride
+ * kalan bekleyenlerin en yuksek onceligini devralir.
+ */
+public void spi_bus_release(void)
+{
+    uint32_t now = k_cycle_get_32();
+    bool batched = false;
+
+    k_spinlock_key_t key = k_spin_lock(&bus_lock);
+
+    if (session.owner != k_current_get() || session.depth == 0) {
+        k_spin_unlock(&bus_lock, key);
+        LOG_ERROR("[%s]: Hatti tutmayan thread birakmaya calisti", __func__);
+        return;
+    }
+    if (--session.depth > 0) {
+        k_spin_unlock(&bus_lock, key);
+        return;
+    }
+
+    account_session(now);
+    if (session.boosted) {
+        k_thread_priority_set(session.owner, session.base_prio);
+    }
+
+    struct spi_bus_waiter *next = pick_next(&batched);
+    if (!next) {
+        session.owner = NULL;
+        k_spin_unlock(&bus_lock, key);
+        return;
+    }
+
+    if (batched) {
+        bus_stats[next->cls].batched++;
+    }
+    grant(next->thread, next->dev, next->cls, next->deadline_us, next->request_cycles);
+    inherit_priority(highest_waiting_priority());
+    k_spin_unlock(&bus_lock, key);
+
+    /* Kilit disinda verilir ki yuksek oncelikli bekleyen hemen calisabilsin */
+    k_sem_give(&next->granted);
+}
+
+/**
+ * @brief Siralama bicimini degistirir. Bekleyen istekler mevcut kuyruklarinda kalir.
+ */
+public void spi_bus_set_policy(enum spi_bus_policy policy)
+{
+    k_spinlock_key_t key = k_spin_lock(&bus_lock);
+    bus_policy = policy;
+    k_spin_unlock(&bus_lock, key);
+}
+
+public void spi_bus_get_stats(struct spi_bus_class_stats stats[SPI_BUS_CLASS_COUNT])
+{
+    k_spinlock_key_t key = k_spin_lock(&bus_lock);
+    memcpy(stats, bus_stats, sizeof(bus_stats));
+    k_spin_unlock(&bus_lock, key);
+}
+
+public void spi_bus_reset_stats(void)
+{
+    k_spinlock_key_t key = k_spin_lock(&bus_lock);
+    memset(bus_stats, 0, sizeof(bus_stats));
+    k_spin_unlock(&bus_lock, key);
+}
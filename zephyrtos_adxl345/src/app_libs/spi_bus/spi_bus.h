@@ -0,0 +1,77 @@
+/**
+ * @file spi_bus.h
+ * @brief Paylasilan SPI hatti icin oncelikli islem zamanlayicisi
+ *
+ * Hatta erisen her islem bir oncelik sinifi ile hatti alir (acquire) ve
+ * birakir (release). Hat mesgulse istekler sinif kuyruklarinda bekler; hat
+ * birakildiginda en yuksek siniftaki istek hatti alir. Ayni sinif icinde son
+ * islemle ayni chip-select'e giden istekler, SPI_BUS_BATCH_MAX ardisik isleme
+ * kadar one alinir (batching). Batching aktarimlari birlestirmez; yalnizca ayni
+ * cihazin oturumlarini arka arkaya dizerek cihaz (CS ve spi_config) gecislerini
+ * azaltir. Her oturum icin bekleme ve toplam sure olculur, verilmisse deadline
+ * ile karsilastirilir.
+ *
+ * Oncelik devri: hatti bekleyen bir thread'in onceligi hatti tutan thread'den
+ * yuksekse, sahibin onceligi oturum bitene kadar bekleyeninkine yukseltilir.
+ * Boylece dusuk oncelikli bir BULK sahibi (ornegin shell register dokumu), RT
+ * bekleyen varken orta oncelikli thread'ler tarafindan bekletilemez.
+ *
+ * Ayri bir thread yoktur; islemler cagiran thread'de calisir. Hatti tutan
+ * thread ic ice acquire yapabilir; boylece bir oturum (ornegin FIFO
+ * bosaltma) icindeki tum register erisimleri tek seferde hatti tutar.
+ *
+ * @note Tek bir hat icin tasarlanmistir. Sensor I2C'ye bagliysa (bkz.
+ *       adxl345_bus.h) ayni zamanlayici I2C oturumlarini siralar; cihaz
+ *       kimligi olarak tasimadan bagimsiz bir isaretci kullanilir.
+ */
+#ifndef SPI_BUS_H
+#define SPI_BUS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "utils.h"
+#include <zephyr/kernel.h>
+
+/** @brief Ayni chip-select'e art arda verilebilecek en fazla oturum sayisi */
+#define SPI_BUS_BATCH_MAX       4
+
+/** @brief Oncelik siniflari; kucuk deger yuksek onceliktir */
+enum spi_bus_class {
+    SPI_BUS_CLASS_RT = 0,       /*!< Gecikmeye duyarli: FIFO bosaltma, interrupt servisi  */
+    SPI_BUS_CLASS_NORMAL,       /*!< Varsayilan: tekil register erisimleri                */
+    SPI_BUS_CLASS_BULK,         /*!< Ayar yazimlari, uzun aktarimlar (flash vb.)          */
+    SPI_BUS_CLASS_COUNT,
+};
+
+/** @brief Hattin istekleri siralama bicimi */
+enum spi_bus_policy {
+    SPI_BUS_POLICY_PRIORITY = 0,    /*!< Sinif onceligi + ayni CS batching                */
+    SPI_BUS_POLICY_FIFO,            /*!< Gelis sirasi (karsilastirma icin)                */
+};
+
+/** @brief Sinif basina oturum istatistikleri */
+struct spi_bus_class_stats {
+    uint32_t sessions;          /*!< Tamamlanan oturum                                    */
+    uint32_t contended;         /*!< Hatti beklemek zorunda kalan oturum                  */
+    uint32_t batched;           /*!< Ayni CS nedeniyle one alinan oturum                  */
+    uint32_t switches;          /*!< Onceki oturumdan farkli cihaza giden oturum          */
+    uint32_t boosted;           /*!< Sahibin onceligi bekleyen icin yukseltilen oturum    */
+    uint32_t deadline_miss;     /*!< Deadline'i asan oturum                               */
+    uint32_t max_wait_cycles;   /*!< En uzun bekleme (istek -> hatti alma)                */
+    uint32_t max_total_cycles;  /*!< En uzun toplam sure (istek -> birakma)               */
+    uint64_t total_cycles;      /*!< Toplam sure (ortalama icin)                          */
+};
+
+public int spi_bus_acquire(const void *dev, enum spi_bus_class cls, uint32_t deadline_us);
+public void spi_bus_release(void);
+public void spi_bus_set_policy(enum spi_bus_policy policy);
+public void spi_bus_get_stats(struct spi_bus_class_stats stats[SPI_BUS_CLASS_COUNT]);
+public void spi_bus_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SPI_BUS_H
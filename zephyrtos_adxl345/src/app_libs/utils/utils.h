@@ -49,10 +49,21 @@
 
 
 
+/*
+ * Renk kodlari her log cagrisinin format metnine eklenir ve ROM'da yer kaplar;
+ * yalnizca CONFIG_APP_LOG_COLOR acikken kullanilir.
+ */
+#if defined(CONFIG_APP_LOG_COLOR)
 #define LOG_DEBUG(fmt, ...) LOG_DBG(COLOR_BRIGHT_MAGENTA fmt RESET_COLOR, ##__VA_ARGS__)    // DEBUG logu cyan
 #define LOG_INFO(fmt, ...) LOG_INF(COLOR_BRIGHT_CYAN fmt RESET_COLOR, ##__VA_ARGS__)     // INFO logu mavi
 #define LOG_ERROR(fmt, ...) LOG_ERR(RED_COLOR fmt COLOR_BOLD, ##__VA_ARGS__)      // ERROR logu kırmızı
 #define LOG_WARNING(fmt, ...) LOG_WRN(YELLOW_COLOR fmt RESET_COLOR, ##__VA_ARGS__) // WARNING logu sarı
+#else
+#define LOG_DEBUG(fmt, ...) LOG_DBG(fmt, ##__VA_ARGS__)
+#define LOG_INFO(fmt, ...) LOG_INF(fmt, ##__VA_ARGS__)
+#define LOG_ERROR(fmt, ...) LOG_ERR(fmt, ##__VA_ARGS__)
+#define LOG_WARNING(fmt, ...) LOG_WRN(fmt, ##__VA_ARGS__)
+#endif
 
 /**
  * @brief private: Fonksiyonun yalnızca bu dosyada kullanılacağını ifade eder.
@@ -0,0 +1,338 @@
+#include "vibration.h"
+#include "sample_pipeline.h"
+#include "utils.h"
+#include <zephyr/kernel.h>
+
+#if defined(CONFIG_CMSIS_DSP_TRANSFORM)
+#include <arm_math.h>
+#define VIBRATION_USE_FFT   1
+#define VIBRATION_BINS      (VIBRATION_WINDOW_SIZE / 2)
+#else
+#define VIBRATION_USE_FFT   0
+#define VIBRATION_BINS      VIBRATION_GOERTZEL_BINS
+#endif
+
+LOG_MODULE_REGISTER(vibration, LOG_LEVEL_INF);
+
+BUILD_ASSERT((VIBRATION_WINDOW_SIZE & (VIBRATION_WINDOW_SIZE - 1)) == 0,
+             "VIBRATION_WINDOW_SIZE 2'nin kuvveti olmali");
+BUILD_ASSERT(VIBRATION_BINS % VIBRATION_BAND_COUNT == 0,
+             "Bin sayisi bant sayisinin kati olmali");
+
+/** @brief Ardisik iki Goertzel bin'i arasindaki FFT bin adimi */
+#define VIB_BIN_STEP        ((VIBRATION_WINDOW_SIZE / 2) / VIBRATION_BINS)
+
+/** @brief Bant basina dusen analiz bin'i */
+#define VIB_BINS_PER_BAND   (VIBRATION_BINS / VIBRATION_BAND_COUNT)
+
+/**
+ * @brief cos(2*pi/N) degeri (Q30).
+ * Derleme zamaninda Taylor serisi ile hesaplanir; calisma aninda kayan nokta kullanilmaz.
+ */
+#define VIB_THETA           (6.283185307179586 / VIBRATION_WINDOW_SIZE)
+#define VIB_COS_STEP_Q30    ((int64_t)((1.0 - VIB_THETA * VIB_THETA / 2.0 +                   \
+                                        VIB_THETA * VIB_THETA * VIB_THETA * VIB_THETA / 24.0) \
+                                       * 1073741824.0 + 0.5))
+
+ZBUS_CHAN_DEFINE(vibration_chan,
+                 struct vibration_result,
+                 NULL,
+                 NULL,
+                 ZBUS_OBSERVERS_EMPTY,
+                 ZBUS_MSG_INIT(0));
+
+/** @brief cos(2*pi*k/N), k = 0..N/2 (Q30) */
+static int32_t cos_q30[VIBRATION_WINDOW_SIZE / 2 + 1];
+static bool cos_ready;
+
+static int16_t window_buf[VIBRATION_WINDOW_SIZE];
+static uint16_t window_fill;
+static uint8_t window_bw_rate;
+static uint32_t window_seq;
+
+static int16_t work_buf[VIBRATION_WINDOW_SIZE];
+static uint32_t bin_power[VIBRATION_BINS];
+
+#if VIBRATION_USE_FFT
+static int16_t fft_out[VIBRATION_WINDOW_SIZE * 2];
+static int16_t fft_mag[VIBRATION_WINDOW_SIZE];
+static arm_rfft_instance_q15 fft_instance;
+#endif
+
+
+/**
+ * @brief Kosinus tablosunu Chebyshev yinelemesi ile tamsayi olarak olusturur.
+ *
+ * cos((k+1)t) = 2cos(t)cos(kt) - cos((k-1)t). Tablo Hann penceresi ve
+ * Goertzel katsayilari icin ortak kullanilir.
+ */
+private void init_cos_table(void)
+{
+    cos_q30[0] = 1 << 30;
+    cos_q30[1] = (int32_t)VIB_COS_STEP_Q30;
+
+    for (int k = 2; k <= VIBRATION_WINDOW_SIZE / 2; k++) {
+        int64_t next = ((2 * VIB_COS_STEP_Q30 * cos_q30[k - 1]) >> 30) - cos_q30[k - 2];
+        cos_q30[k] = (int32_t)next;
+    }
+
+#if VIBRATION_USE_FFT
+    arm_rfft_init_q15(&fft_instance, VIBRATION_WINDOW_SIZE, 0, 1);
+#endif
+    cos_ready = true;
+}
+
+/**
+ * @brief cos(2*pi*n/N) degerini tablo simetrisi ile dondurur (Q30), n = 0..N-1.
+ */
+private int32_t cos_lookup( uint32_t n )
+{
+    n &= VIBRATION_WINDOW_SIZE - 1;
+    return cos_q30[n <= VIBRATION_WINDOW_SIZE / 2 ? n : VIBRATION_WINDOW_SIZE - n];
+}
+
+/**
+ * @brief DC bileseni cikarir, Q15'e olcekler ve Hann penceresi uygular.
+ */
+private void prepare_window( const int16_t *window )
+{
+    int32_t sum = 0;
+
+    for (int n = 0; n < VIBRATION_WINDOW_SIZE; n++) {
+        sum += window[n];
+    }
+    int32_t mean = sum / VIBRATION_WINDOW_SIZE;
+
+    for (int n = 0; n < VIBRATION_WINDOW_SIZE; n++) {
+        int32_t x = CLAMP((window[n] - mean) * (1 << VIBRATION_INPUT_SHIFT), INT16_MIN, INT16_MAX);
+        int32_t hann_q15 = (1 << 14) - (cos_lookup(n) >> 16);
+
+        work_buf[n] = (int16_t)((x * hann_q15) >> 15);
+    }
+}
+
+/**
+ * @brief Analiz bin'inin FFT bin indeksini dondurur.
+ */
+private uint32_t bin_index( uint32_t i )
+{
+    return i * VIB_BIN_STEP + VIB_BIN_STEP / 2;
+}
+
+#if VIBRATION_USE_FFT
+/**
+ * @brief CMSIS-DSP Q15 gercek FFT ile tum bin'lerin gucunu hesaplar.
+ *
+ * arm_rfft_q15 giris tamponunu degistirdigi icin work_buf yerinde kullanilir.
+ */
+private void compute_power(void)
+{
+    arm_rfft_q15(&fft_instance, work_buf, fft_out);
+    arm_cmplx_mag_squared_q15(fft_out, fft_mag, VIBRATION_BINS);
+
+    for (int i = 0; i < VIBRATION_BINS; i++) {
+        bin_power[i] = (uint16_t)fft_mag[i];
+    }
+}
+#else
+/**
+ * @brief Secili bin'lerin gucunu Goertzel filtre bankasi ile hesaplar.
+ *
+ * Her bin icin s[n] = x[n] + 2cos(w)s[n-1] - s[n-2] yinelemesi tamsayi
+ * aritmetigi ile calistirilir; guc s1^2 + s2^2 - 2cos(w)s1s2 olarak bulunur.
+ */
+private void compute_power(void)
+{
+    for (int i = 0; i < VIBRATION_BINS; i++) {
+        int64_t coeff = 2 * (int64_t)cos_q30[bin_index(i)];
+        int32_t s1 = 0;
+        int32_t s2 = 0;
+
+        for (int n = 0; n < VIBRATION_WINDOW_SIZE; n++) {
+            int32_t s0 = work_buf[n] + (int32_t)((coeff * s1) >> 30) - s2;
+            s2 = s1;
+            s1 = s0;
+        }
+
+        int64_t power = (int64_t)s1 * s1 + (int64_t)s2 * s2 - ((coeff * s1) >> 30) * s2;
+        uint64_t scaled = (uint64_t)MAX(power, 0) >> VIBRATION_POWER_SHIFT;
+
+        bin_power[i] = (uint32_t)MIN(scaled, UINT32_MAX);
+    }
+}
+#endif
+
+/**
+ * @brief Bir pencerenin spektrumunu hesaplar.
+ *
+ * Bant enerjileri, en guclu bin ve harcanan cycle sayisi `result` icine yazilir.
+ * `seq` alani degistirilmez.
+ *
+ * @param[in]  window   VIBRATION_WINDOW_SIZE uzunlugunda ornekler (FULL_RES LSB, 3.9 mg).
+ * @param[in]  odr_mhz  Orneklerin alindigi veri hizi (mHz).
+ * @param[out] result   Analiz sonucu.
+ */
+public void vibration_analyze(const int16_t *window, uint32_t odr_mhz, struct vibration_result *result)
+{
+    if (!cos_ready) {
+        init_cos_table();
+    }
+
+    uint32_t start = k_cycle_get_32();
+    uint32_t peak_bin = 0;
+
+    prepare_window(window);
+    compute_power();
+
+    memset(result->band_energy, 0, sizeof(result->band_energy));
+    result->peak_energy = 0;
+
+    for (uint32_t i = 0; i < VIBRATION_BINS; i++) {
+        uint32_t *band = &result->band_energy[i / VIB_BINS_PER_BAND];
+
+        *band = (*band > UINT32_MAX - bin_power[i]) ? UINT32_MAX : *band + bin_power[i];
+#if VIBRATION_USE_FFT
+        /* FFT bin 0 DC'dir; Goertzel'de analiz bin'i 0 zaten FFT bin VIB_BIN_STEP / 2'dir */
+        if (i == 0) {
+            continue;
+        }
+#endif
+        if (bin_power[i] > result->peak_energy) {
+            result->peak_energy = bin_power[i];
+            peak_bin = i;
+        }
+    }
+
+    result->peak_freq_mhz = (uint32_t)(((uint64_t)bin_index(peak_bin) * odr_mhz) / VIBRATION_WINDOW_SIZE);
+    result->cycles = k_cycle_get_32() - start;
+}
+
+/**
+ * @brief VIBRATION_AXIS ile secilen eksenin degerini FULL_RES LSB'sine (3.9 mg) tasir.
+ *
+ * Pencere boyunca range degisse de (autorange) ornekler ayni olcekte kalir.
+ * Negatif degerin sola kaydirilmasi tanimsiz oldugu icin carpma kullanilir.
+ */
+private inline int16_t axis_value( const struct adxl345_sample *sample , uint8_t shift )
+{
+#if VIBRATION_AXIS == 0
+    return sample->x * (1 << shift);
+#elif VIBRATION_AXIS == 1
+    return sample->y * (1 << shift);
+#else
+    return sample->z * (1 << shift);
+#endif
+}
+
+/**
+ * @brief Ornek bloklarini pencereye toplar, pencere dolunca analiz eder ve yayinlar.
+ *
+ * Bloktan once ornek kaybedildiyse (`overrun`) pencere bitisik olmaz; yarim
+ * pencere atilir ve toplama bu bloktan yeniden baslar.
+ */
+private void vibration_block_cb( const struct zbus_channel *chan )
+{
+    const struct adxl345_block *block = zbus_chan_const_msg(chan);
+    uint8_t shift = adxl345_lsb_shift(block->data_format);
+
+    if (block->bw_rate != window_bw_rate || block->overrun) {
+        window_bw_rate = block->bw_rate;
+        window_fill = 0;
+    }
+
+    for (int i = 0; i < block->count; i++) {
+        window_buf[window_fill++] = axis_value(&block->samples[i], shift);
+        if (window_fill < VIBRATION_WINDOW_SIZE) {
+            continue;
+        }
+
+        struct vibration_result result = { .seq = window_seq++ };
+
+        vibration_analyze(window_buf, adxl345_odr_mhz(window_bw_rate), &result);
+        zbus_chan_pub(&vibration_chan, &result, K_NO_WAIT);
+        window_fill = 0;
+    }
+}
+
+ZBUS_LISTENER_DEFINE(vibration_listener, vibration_block_cb);
+ZBUS_CHAN_ADD_OBS(adxl_block_chan, vibration_listener, 1);
+
+
+#if defined(CONFIG_SHELL)
+#include <zephyr/shell/shell.h>
+
+/** @brief Benchmark sinyalindeki iki tonun FFT bin'leri */
+#define VIB_BENCH_TONE1_BIN     21
+#define VIB_BENCH_TONE2_BIN     71
+
+/**
+ * @brief Iki tonlu sentetik bir pencere ile analiz suresini olcer.
+ *
+ * Sonuc 1600 Hz ve 3200 Hz ODR'de pencere suresine oranlanarak surekli
+ * calisma icin gereken CPU yuku olarak raporlanir.
+ */
+private int cmd_vib_bench(const struct shell *sh, size_t argc, char **argv)
+{
+    static int16_t bench_window[VIBRATION_WINDOW_SIZE];
+    struct vibration_result result;
+    unsigned long iterations = 100;
+    uint64_t total = 0;
+    int err = 0;
+
+    if (argc > 1) {
+        iterations = shell_strtoul(argv[1], 0, &err);
+        if (err || iterations == 0) {
+            return -EINVAL;
+        }
+    }
+    if (!cos_ready) {
+        init_cos_table();
+    }
+
+    for (uint32_t n = 0; n < VIBRATION_WINDOW_SIZE; n++) {
+        bench_window[n] = (int16_t)(256 + (cos_lookup(n * VIB_BENCH_TONE1_BIN) >> 22) +
+                                          (cos_lookup(n * VIB_BENCH_TONE2_BIN) >> 24));
+    }
+
+    for (unsigned long i = 0; i < iterations; i++) {
+        vibration_analyze(bench_window, adxl345_odr_mhz(ADXL_BW_RATE_3200HZ), &result);
+        total += result.cycles;
+    }
+
+    uint64_t ns = k_cyc_to_ns_floor64(total / iterations);
+
+    shell_print(sh, "yontem        : %s, N=%d, %d bin", VIBRATION_USE_FFT ? "FFT (CMSIS-DSP)" : "Goertzel",
+                VIBRATION_WINDOW_SIZE, VIBRATION_BINS);
+    shell_print(sh, "pencere basina: %llu cycle, %llu ns", total / iterations, ns);
+    shell_print(sh, "CPU yuku      : %%%llu.%02llu @1600 Hz, %%%llu.%02llu @3200 Hz",
+                (ns * 1600 / VIBRATION_WINDOW_SIZE) / 10000000, ((ns * 1600 / VIBRATION_WINDOW_SIZE) / 100000) % 100,
+                (ns * 3200 / VIBRATION_WINDOW_SIZE) / 10000000, ((ns * 3200 / VIBRATION_WINDOW_SIZE) / 100000) % 100);
+    shell_print(sh, "tepe frekansi : %u mHz (beklenen %u mHz)", result.peak_freq_mhz,
+                (VIB_BENCH_TONE1_BIN * 3200000U) / VIBRATION_WINDOW_SIZE);
+    return 0;
+}
+
+private int cmd_vib_show(const struct shell *sh, size_t argc, char **argv)
+{
+    struct vibration_result result;
+
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+    zbus_chan_read(&vibration_chan, &result, K_MSEC(10));
+
+    shell_print(sh, "pencere %u, tepe %u mHz (enerji %u), %u cycle",
+                result.seq, result.peak_freq_mhz, result.peak_energy, result.cycles);
+    for (int b = 0; b < VIBRATION_BAND_COUNT; b++) {
+        shell_print(sh, "  bant %d: %u", b, result.band_energy[b]);
+    }
+    return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_vib,
+    SHELL_CMD_ARG(bench, NULL, "Analiz suresini olc: bench [tekrar]", cmd_vib_bench, 1, 1),
+    SHELL_CMD_ARG(show,  NULL, "Son pencere sonucunu goster",         cmd_vib_show,  1, 0),
+    SHELL_SUBCMD_SET_END
+);
+
+SHELL_SUBCMD_ADD((adxl), vib, &sub_vib, "Titresim spektrumu", NULL, 0, 0);
+#endif
@@ -0,0 +1,62 @@
+/**
+ * @file vibration.h
+ * @brief Sabit noktali titresim spektrum analizi
+ *
+ * Sample pipeline'dan gelen bloklar secilen eksende pencerelere toplanir.
+ * Her pencere icin DC bileseni cikarilir, Hann penceresi uygulanir ve
+ * CMSIS-DSP varsa Q15 gercek FFT, yoksa secili frekans bin'leri icin
+ * Goertzel filtre bankasi calistirilir. Bant enerjileri ve tepe frekansi
+ * `vibration_chan` zbus kanalina yayinlanir.
+ *
+ * @note Enerjiler goreli birimdedir; FFT ve Goertzel yollari farkli olcekler
+ *       uretir, ayni derlemedeki pencereler birbiriyle karsilastirilmalidir.
+ */
+#ifndef VIBRATION_H
+#define VIBRATION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "adxl345.h"
+#include <zephyr/zbus/zbus.h>
+
+/** @brief Pencere uzunlugu (ornek, 2'nin kuvveti olmali) */
+#define VIBRATION_WINDOW_SIZE       256
+
+/** @brief Yayinlanan frekans bandi sayisi (0..ODR/2 esit bolunur) */
+#define VIBRATION_BAND_COUNT        8
+
+/**
+ * @brief FFT yokken Goertzel ile analiz edilen bin sayisi (bant sayisinin kati).
+ * N/4 secildiginde bin adimi 2 olur; Hann ana lobu (±2 bin) aradaki tonlari da kapsar.
+ */
+#define VIBRATION_GOERTZEL_BINS     64
+
+/** @brief Analiz edilen eksen: 0 = X, 1 = Y, 2 = Z */
+#define VIBRATION_AXIS              2
+
+/** @brief FULL_RES LSB'den (±4096) Q15'e gecerken uygulanan sola kaydirma */
+#define VIBRATION_INPUT_SHIFT       3
+
+/** @brief Goertzel gucunun 32 bit'e sigdirilmasi icin saga kaydirma */
+#define VIBRATION_POWER_SHIFT       16
+
+/** @brief Bir pencerenin analiz sonucu */
+struct vibration_result {
+    uint32_t band_energy[VIBRATION_BAND_COUNT];     /*!< Bant enerjileri (goreli)       */
+    uint32_t peak_freq_mhz;                         /*!< En guclu bin'in frekansi (mHz) */
+    uint32_t peak_energy;                           /*!< En guclu bin'in enerjisi       */
+    uint32_t cycles;                                /*!< Analizin harcadigi CPU cycle'i */
+    uint32_t seq;                                   /*!< Pencere sira numarasi          */
+};
+
+ZBUS_CHAN_DECLARE(vibration_chan);
+
+public void vibration_analyze(const int16_t *window, uint32_t odr_mhz, struct vibration_result *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // VIBRATION_H